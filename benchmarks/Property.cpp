@@ -0,0 +1,125 @@
+// Compares converting property values on every lookup, like
+// sfg::Engine::GetProperty() used to, with converting them once
+// through sfg::priv::PropertyValue.
+
+#include <SFGUI/Engine.hpp>
+#include <SFGUI/PropertyValue.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+
+namespace {
+
+const std::size_t lookup_rounds = 200000;
+
+// A typical mix of values as set by the BREW engine.
+const char* const float_values[] = { "2", "5", "0.5", "1.5", "12" };
+const char* const color_values[] = { "#e6e6e6ff", "#5a6266ff", "#46469696" };
+const char* const unsigned_values[] = { "12", "1", "0" };
+
+// The previous implementation, kept here for comparison.
+template <typename T>
+T ParseValue( const std::string& value ) {
+	T out_value;
+	std::istringstream sstr( value );
+	sstr >> out_value;
+
+	if( sstr.fail() ) {
+		std::cerr << "Unable to convert " << value << ".\n";
+		std::exit( EXIT_FAILURE );
+	}
+
+	return out_value;
+}
+
+template <typename T>
+T GetValue( const sfg::priv::PropertyValue& value ) {
+	T out_value;
+
+	if( !value.Get( out_value ) ) {
+		std::cerr << "Unable to convert " << value.GetString() << ".\n";
+		std::exit( EXIT_FAILURE );
+	}
+
+	return out_value;
+}
+
+struct ParseLookup {
+	template <typename T>
+	T operator()( const std::string& value, T ) const {
+		return ParseValue<T>( value );
+	}
+};
+
+struct TypedLookup {
+	template <typename T>
+	T operator()( const sfg::priv::PropertyValue& value, T ) const {
+		return GetValue<T>( value );
+	}
+};
+
+struct Sum {
+	float floats = 0.f;
+	unsigned int colors = 0;
+	unsigned int unsigned_ints = 0;
+};
+
+template <typename Value, typename Lookup>
+double Run( const char* name, const std::vector<Value>& floats, const std::vector<Value>& colors, const std::vector<Value>& unsigned_ints, Lookup lookup, Sum& sum ) {
+	auto start = std::chrono::steady_clock::now();
+
+	for( std::size_t round = 0; round < lookup_rounds; ++round ) {
+		for( const auto& value : floats ) {
+			sum.floats += lookup( value, float() );
+		}
+
+		for( const auto& value : colors ) {
+			sum.colors += lookup( value, sf::Color() ).a;
+		}
+
+		for( const auto& value : unsigned_ints ) {
+			sum.unsigned_ints += lookup( value, 0u );
+		}
+	}
+
+	auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+	auto lookups = static_cast<double>( lookup_rounds * ( floats.size() + colors.size() + unsigned_ints.size() ) );
+
+	std::cout << name << ": " << seconds * 1000. << " ms, " << seconds * 1000000000. / lookups << " ns per lookup\n";
+
+	return seconds;
+}
+
+}
+
+int main() {
+	std::vector<std::string> string_floats( std::begin( float_values ), std::end( float_values ) );
+	std::vector<std::string> string_colors( std::begin( color_values ), std::end( color_values ) );
+	std::vector<std::string> string_unsigned_ints( std::begin( unsigned_values ), std::end( unsigned_values ) );
+
+	std::vector<sfg::priv::PropertyValue> typed_floats( string_floats.begin(), string_floats.end() );
+	std::vector<sfg::priv::PropertyValue> typed_colors( string_colors.begin(), string_colors.end() );
+	std::vector<sfg::priv::PropertyValue> typed_unsigned_ints( string_unsigned_ints.begin(), string_unsigned_ints.end() );
+
+	Sum string_sum;
+	Sum typed_sum;
+
+	auto string_seconds = Run( "Parsing strings", string_floats, string_colors, string_unsigned_ints, ParseLookup(), string_sum );
+
+	auto typed_seconds = Run( "sfg::priv::PropertyValue", typed_floats, typed_colors, typed_unsigned_ints, TypedLookup(), typed_sum );
+
+	if( ( string_sum.floats != typed_sum.floats ) || ( string_sum.colors != typed_sum.colors ) || ( string_sum.unsigned_ints != typed_sum.unsigned_ints ) ) {
+		std::cerr << "Converted values differ.\n";
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "Speedup: " << string_seconds / typed_seconds << "x\n";
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+// Compares emitting signals through sfg::SignalContainer with the
+// std::map based storage SFGUI used before.
+
+#include <SFGUI/Signal.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <vector>
+#include <cstdlib>
+
+namespace {
+
+// The previous implementation, kept here for comparison.
+class MapSignal {
+	public:
+		unsigned int Connect( std::function<void()> delegate ) {
+			if( !m_delegates ) {
+				m_delegates.reset( new DelegateMap );
+			}
+
+			(*m_delegates)[m_serial] = delegate;
+			return m_serial++;
+		}
+
+		void operator()() const {
+			if( !m_delegates ) {
+				return;
+			}
+
+			for( const auto& delegate : *m_delegates ) {
+				delegate.second();
+			}
+		}
+
+	private:
+		typedef std::map<unsigned int, std::function<void()>> DelegateMap;
+
+		std::unique_ptr<DelegateMap> m_delegates;
+		unsigned int m_serial = 1;
+};
+
+class MapSignalContainer {
+	public:
+		MapSignal& operator[]( sfg::Signal::SignalID id ) {
+			if( !m_signals ) {
+				m_signals.reset( new SignalMap );
+			}
+
+			return (*m_signals)[id];
+		}
+
+		void Emit( sfg::Signal::SignalID id ) {
+			if( !m_signals || !id ) {
+				return;
+			}
+
+			auto signal_iter = m_signals->find( id );
+
+			if( signal_iter != m_signals->end() ) {
+				signal_iter->second();
+			}
+		}
+
+	private:
+		typedef std::map<sfg::Signal::SignalID, MapSignal> SignalMap;
+
+		std::unique_ptr<SignalMap> m_signals;
+};
+
+const std::size_t container_count = 10000;
+const std::size_t emit_rounds = 200;
+
+// Like a widget, every container has a few signals connected and
+// most emits are for signals nobody listens to.
+const sfg::Signal::SignalID connected_ids[] = { 1, 4, 9 };
+const sfg::Signal::SignalID emitted_ids[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+template <typename Container>
+double Run( const char* name, unsigned int& counter ) {
+	std::vector<Container> containers( container_count );
+
+	for( auto& container : containers ) {
+		for( auto id : connected_ids ) {
+			container[id].Connect( [&counter] { ++counter; } );
+			container[id].Connect( [&counter] { counter += 2; } );
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	for( std::size_t round = 0; round < emit_rounds; ++round ) {
+		for( auto& container : containers ) {
+			for( auto id : emitted_ids ) {
+				container.Emit( id );
+			}
+		}
+	}
+
+	auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+	auto emits = static_cast<double>( container_count * emit_rounds * ( sizeof( emitted_ids ) / sizeof( emitted_ids[0] ) ) );
+
+	std::cout << name << ": " << seconds * 1000. << " ms, " << seconds * 1000000000. / emits << " ns per emit\n";
+
+	return seconds;
+}
+
+}
+
+int main() {
+	unsigned int map_counter = 0;
+	unsigned int flat_counter = 0;
+
+	auto map_seconds = Run<MapSignalContainer>( "std::map storage", map_counter );
+	auto flat_seconds = Run<sfg::SignalContainer>( "sfg::SignalContainer", flat_counter );
+
+	if( map_counter != flat_counter ) {
+		std::cerr << "Delegate call counts differ.\n";
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "Speedup: " << map_seconds / flat_seconds << "x\n";
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+// Measures how fast generated themes of different sizes are parsed
+// by sfg::parser::theme::ParseString().
+
+#include <SFGUI/Parsers/ThemeParser/Parse.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+
+namespace {
+
+const std::size_t rule_counts[] = { 100, 3000, 30000 };
+const std::size_t bytes_per_size = 20 * 1024 * 1024;
+
+const char* const widgets[] = { "Window", "Button", "Label", "Entry", "Scale", "ComboBox", "Notebook", "*" };
+const char* const states[] = { "NORMAL", "PRELIGHT", "ACTIVE", "SELECTED", "INSENSITIVE" };
+const char* const properties[] = { "Color", "BackgroundColor", "BorderColor", "BorderWidth", "Padding", "FontSize", "FontName" };
+const char* const values[] = { "#c6cbc4ff", "#464646ff", "1", "5.5", "12", "Default" };
+
+// Deterministic mix of simple, compound, hierarchical and grouped selectors.
+std::string GenerateTheme( std::size_t rule_count ) {
+	std::ostringstream theme;
+
+	for( std::size_t index = 0; index < rule_count; ++index ) {
+		if( index % 50 == 0 ) {
+			theme << "/* Section " << index / 50 << " */\n";
+		}
+
+		theme << widgets[index % 8];
+
+		if( index % 3 == 0 ) {
+			theme << "#id" << index;
+		}
+
+		if( index % 5 == 0 ) {
+			theme << ".class" << index % 7;
+		}
+
+		if( index % 4 == 0 ) {
+			theme << ":" << states[index % 5];
+		}
+
+		if( index % 6 == 0 ) {
+			theme << " > " << widgets[( index + 3 ) % 8];
+		}
+
+		if( index % 10 == 0 ) {
+			theme << ", " << widgets[( index + 5 ) % 8] << " " << widgets[( index + 1 ) % 8];
+		}
+
+		theme << " {\n";
+
+		for( std::size_t declaration = 0; declaration < 1 + index % 4; ++declaration ) {
+			theme << "\t" << properties[( index + declaration ) % 7] << ": " << values[( index * 3 + declaration ) % 6] << ";\n";
+		}
+
+		theme << "}\n\n";
+	}
+
+	return theme.str();
+}
+
+}
+
+int main() {
+	for( auto rule_count : rule_counts ) {
+		auto theme = GenerateTheme( rule_count );
+		auto rounds = std::max( bytes_per_size / theme.size(), std::size_t( 1 ) );
+
+		auto start = std::chrono::steady_clock::now();
+
+		for( std::size_t round = 0; round < rounds; ++round ) {
+			if( sfg::parser::theme::ParseString( theme ).size() != rule_count ) {
+				std::cerr << "Couldn't parse generated theme.\n";
+				return EXIT_FAILURE;
+			}
+		}
+
+		auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+		std::cout
+			<< rule_count << " rules (" << theme.size() / 1024 << " KiB): "
+			<< seconds * 1000. / static_cast<double>( rounds ) << " ms per theme, "
+			<< static_cast<double>( theme.size() * rounds ) / ( 1024. * 1024. ) / seconds << " MiB/s\n";
+	}
+
+	return EXIT_SUCCESS;
+}
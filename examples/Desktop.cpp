@@ -2,6 +2,7 @@
 #include <SFGUI/Widgets.hpp>
 
 #include <SFML/Graphics.hpp>
+#include <vector>
 
 int main() {
 	sf::RenderWindow render_window( sf::VideoMode( 800, 600 ), "SFGUI Desktop Example" );
@@ -76,6 +77,7 @@ int main() {
 	} );
 
 	sf::Event event;
+	std::vector<sf::Event> events;
 
 	while( render_window.isOpen() ) {
 		while( render_window.pollEvent( event ) ) {
@@ -86,10 +88,15 @@ int main() {
 				return 0;
 			}
 			else {
-				desktop.HandleEvent( event );
+				events.push_back( event );
 			}
 		}
 
+		// Handing the desktop all events of a frame at once lets it
+		// skip mouse moves that are superseded by later ones.
+		desktop.HandleEvents( events );
+		events.clear();
+
 		desktop.Update( 0.f );
 		render_window.clear();
 		sfgui.Display( render_window );
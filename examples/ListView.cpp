@@ -0,0 +1,88 @@
+// Always include the necessary header files.
+// Including SFGUI/Widgets.hpp includes everything
+// you can possibly need automatically.
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <cstdlib>
+
+int main() {
+	// Create the main SFML window
+	sf::RenderWindow app_window( sf::VideoMode( 800, 600 ), "SFGUI ListView Example", sf::Style::Titlebar | sf::Style::Close );
+
+	// We have to do this because we don't use SFML to draw.
+	app_window.resetGLStates();
+
+	// Create an SFGUI. This is required before doing anything with SFGUI.
+	sfg::SFGUI sfgui;
+
+	// Create our main SFGUI window
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Title" );
+
+	// A list view doesn't create a widget for every item. It only
+	// creates as many rows as it needs to fill the visible area and
+	// reuses them when scrolling. To do this it needs a function that
+	// creates a new row...
+	auto factory = [] {
+		return sfg::Label::Create();
+	};
+
+	// ...and a function that fills a row with the data of an item.
+	auto binder = []( sfg::Widget::Ptr row, std::size_t item ) {
+		std::static_pointer_cast<sfg::Label>( row )->SetText( "Item " + std::to_string( item ) );
+	};
+
+	// Create the list view with rows that are 20 pixels high. If rows
+	// can differ in height use sfg::ListView::RowHeightMode::ESTIMATED
+	// and pass an estimate instead. Rows will be measured once they
+	// become visible.
+	auto list_view = sfg::ListView::Create( factory, binder, 20.f );
+
+	// Show a million items.
+	list_view->SetItemCount( 1000000 );
+
+	// The list view has to be placed inside a viewport.
+	auto scrolledwindow = sfg::ScrolledWindow::Create();
+	scrolledwindow->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_AUTOMATIC | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolledwindow->AddWithViewport( list_view );
+
+	// Always remember to set the minimum size of a ScrolledWindow.
+	scrolledwindow->SetRequisition( sf::Vector2f( 300.f, 400.f ) );
+
+	// Add the ScrolledWindow to the window.
+	window->Add( scrolledwindow );
+
+	// Start the game loop
+	while ( app_window.isOpen() ) {
+		// Process events
+		sf::Event event;
+
+		while ( app_window.pollEvent( event ) ) {
+			// Handle events
+			window->HandleEvent( event );
+
+			// Close window : exit
+			if ( event.type == sf::Event::Closed ) {
+				return EXIT_SUCCESS;
+			}
+		}
+
+		// Update the GUI, note that you shouldn't normally
+		// pass 0 seconds to the update method.
+		window->Update( 0.f );
+
+		// Clear screen
+		app_window.clear();
+
+		// Draw the GUI
+		sfgui.Display( app_window );
+
+		// Update the window
+		app_window.display();
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace sfg {
+
+class Atom;
+
+namespace priv {
+
+/** Bloom filter over the names, IDs and classes of a widget's ancestors.
+ * Used to quickly reject selectors that require an ancestor no ancestor of
+ * the widget could match. False positives are possible, false negatives not.
+ */
+class SFGUI_API AncestorFilter {
+	public:
+		/** Ctor.
+		 * Creates an empty filter.
+		 */
+		AncestorFilter();
+
+		/** Add widget name.
+		 * @param name Widget name.
+		 */
+		void AddName( const Atom& name );
+
+		/** Add ID.
+		 * @param id ID.
+		 */
+		void AddId( const std::string& id );
+
+		/** Add class.
+		 * @param class_ Class.
+		 */
+		void AddClass( const std::string& class_ );
+
+		/** Check if everything added to another filter might also be in this one.
+		 * @param other Other filter.
+		 * @return false if at least one of the other filter's entries is definitely missing.
+		 */
+		bool MightContain( const AncestorFilter& other ) const;
+
+	private:
+		void Add( std::size_t hash );
+
+		static const std::size_t word_count = 4;
+
+		std::uint64_t m_bits[word_count];
+};
+
+}
+}
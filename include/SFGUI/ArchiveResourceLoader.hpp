@@ -0,0 +1,49 @@
+#pragma once
+
+#include <SFGUI/ResourceLoader.hpp>
+
+#include <memory>
+#include <string>
+#include <cstddef>
+
+namespace sfg {
+
+namespace priv {
+class MappedFile;
+}
+
+/** Resource loader for loading from a packed resource archive.
+ * The archive is memory mapped once and resources are looked up by their
+ * name within the archive. Images may be stored pre-decoded so they only
+ * have to be copied. Archives are built with the PackResources tool.
+ *
+ * Add the loader with ResourceManager::AddLoader(). Paths must begin with the
+ * loader's identifier, e.g. "archive:icons/close.png".
+ */
+class SFGUI_API ArchiveResourceLoader : public ResourceLoader {
+	public:
+		/** Ctor.
+		 * @param path Path of the archive.
+		 * @param identifier Identifier, use different ones to add multiple archives.
+		 */
+		ArchiveResourceLoader( const std::string& path, const std::string& identifier = "archive" );
+
+		/** Check whether the archive could be opened.
+		 * @return true if opened.
+		 */
+		bool IsOpen() const;
+
+		std::shared_ptr<const sf::Font> LoadFont( const std::string& path ) const override;
+		std::shared_ptr<const sf::Image> LoadImage( const std::string& path ) const override;
+		const std::string& GetIdentifier() const override;
+
+	private:
+		bool Validate();
+		const char* FindEntry( const std::string& name ) const;
+
+		std::shared_ptr<const priv::MappedFile> m_file;
+		std::string m_identifier;
+		std::size_t m_entry_count;
+};
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <string>
+
+namespace sfg {
+
+/** Interned string.
+ * Atoms of equal strings share the same ID, so comparing them is as cheap as
+ * comparing integers. Interning happens when an atom is created from a string,
+ * keep atoms around (e.g. as static constants) to only pay for it once.
+ * Interned strings are never released.
+ */
+class SFGUI_API Atom {
+	public:
+		/** Ctor.
+		 * Creates the atom of the empty string.
+		 */
+		Atom();
+
+		/** Ctor.
+		 * @param string String to intern.
+		 */
+		explicit Atom( const std::string& string );
+
+		/** Get interned string.
+		 * @return String.
+		 */
+		const std::string& GetString() const;
+
+		/** Get ID.
+		 * IDs are small and dense, they can be used to index tables.
+		 * @return ID, 0 for the empty string.
+		 */
+		unsigned int GetId() const;
+
+		/** Compare.
+		 * @param other Other atom.
+		 * @return true if both atoms refer to the same string.
+		 */
+		bool operator==( const Atom& other ) const;
+
+		/** Compare.
+		 * @param other Other atom.
+		 * @return true if the atoms refer to different strings.
+		 */
+		bool operator!=( const Atom& other ) const;
+
+		/** Order by ID.
+		 * This doesn't order the interned strings alphabetically.
+		 * @param other Other atom.
+		 * @return true if this atom's ID is smaller.
+		 */
+		bool operator<( const Atom& other ) const;
+
+	private:
+		unsigned int m_id;
+};
+
+}
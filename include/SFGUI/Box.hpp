@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <deque>
+#include <unordered_map>
 
 namespace sfg {
 
@@ -79,6 +80,11 @@ class SFGUI_API Box : public Container {
 		 */
 		float GetSpacing() const;
 
+		/** Used to inform parent that a child's requisition has changed.
+		 * @param child Widget whose requisition changed.
+		 */
+		void HandleChildRequisitionChange( Widget::PtrConst child ) override;
+
 	protected:
 		/** Get requisition.
 		 * @return Requisition.
@@ -90,12 +96,16 @@ class SFGUI_API Box : public Container {
 			Widget* widget;
 			bool expand;
 			bool fill;
+			bool interesting;
+			sf::Vector2f requisition;
+			float position;
 
 			ChildInfo( Widget::Ptr widget_, bool expand_ = true, bool fill_ = true );
 			bool operator==( const ChildInfo& rhs ) const;
 		};
 
 		typedef std::deque<ChildInfo> ChildrenCont;
+		typedef std::unordered_map<const Widget*, std::size_t> ChildIndexMap;
 
 		Box( Orientation orientation = Orientation::HORIZONTAL, float spacing = 0.f );
 
@@ -104,12 +114,37 @@ class SFGUI_API Box : public Container {
 		void HandleSizeChange() override;
 		void HandleRequisitionChange() override;
 
-		void AllocateChildren() const;
+		void AllocateChildren();
 		bool IsChildInteresting( Widget* child ) const;
 
+		void UpdateTotals();
+		void AddToTotals( const ChildInfo& child );
+		void RemoveFromTotals( const ChildInfo& child );
+		void InvalidateChild( std::size_t index );
+		void InvalidateLayout();
+
 		ChildrenCont m_box_children;
+		ChildIndexMap m_child_indices;
 		float m_spacing;
 		Orientation m_orientation;
+
+		sf::Vector2f m_children_requisition;
+		double m_children_length;
+		unsigned int m_num_visible;
+		unsigned int m_num_expand;
+		unsigned int m_num_broadest_children;
+		unsigned int m_num_total_updates;
+
+		std::size_t m_first_invalid_child;
+		std::size_t m_last_invalid_child;
+
+		float m_allocated_extra;
+		float m_allocated_breadth;
+		float m_allocated_gap;
+
+		bool m_totals_invalid;
+		bool m_allocation_invalid;
+		bool m_child_indices_invalid;
 };
 
 }
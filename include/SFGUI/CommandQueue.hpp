@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <atomic>
+#include <functional>
+
+namespace sfg {
+
+/** Command queue.
+ * Lets any number of threads queue up commands that are executed by a single
+ * consumer thread, usually the GUI thread. Pushing never blocks.
+ */
+class SFGUI_API CommandQueue {
+	public:
+		typedef std::function<void()> Command; //!< Command type.
+
+		/** Ctor.
+		 */
+		CommandQueue();
+
+		/** Dtor.
+		 * Commands that have not been executed yet are discarded.
+		 */
+		~CommandQueue();
+
+		CommandQueue( const CommandQueue& ) = delete;
+		CommandQueue& operator=( const CommandQueue& ) = delete;
+
+		/** Queue a command.
+		 * Safe to call from any thread.
+		 * @param command Command.
+		 */
+		void Push( Command command );
+
+		/** Execute queued commands in the order they were pushed.
+		 * Must only be called by the consumer thread. At least one command is
+		 * executed if any are queued, the remaining ones are left for the next
+		 * call once the time budget is exhausted. Commands pushed while this
+		 * runs are left for the next call as well.
+		 * @param budget Time budget in seconds, 0 to execute all queued commands.
+		 * @return Number of executed commands.
+		 */
+		std::size_t Execute( float budget = 0.f );
+
+	private:
+		struct Node {
+			std::atomic<Node*> next;
+			Command command;
+
+			Node();
+		};
+
+		Node* Pop();
+
+		std::atomic<Node*> m_head; ///< Last pushed node, written by producers.
+		Node* m_tail; ///< Next node to pop, only touched by the consumer.
+		Node m_stub;
+};
+
+}
@@ -53,11 +53,26 @@ class SFGUI_API Container : public Widget {
 		 */
 		virtual void HandleChildInvalidate( Widget::PtrConst child ) const;
 
+		/** Used to inform parent that a child's requisition has changed.
+		 * Called before the parent is asked to resize itself.
+		 * @param child Widget whose requisition changed.
+		 */
+		virtual void HandleChildRequisitionChange( Widget::PtrConst child );
+
 		/** Handle changing of absolute position
 		 */
 		void HandleAbsolutePositionChange() override;
 
+		/** Used to inform parent that a child's allocation has changed.
+		 * Causes the grid used to route mouse events to be rebuilt.
+		 */
+		void InvalidateHitGrid();
+
 	protected:
+		/** Ctor.
+		 */
+		Container();
+
 		/** Handle adding children.
 		 * @param child Child widget.
 		 * @return true if child was added, false otherwise.
@@ -73,6 +88,10 @@ class SFGUI_API Container : public Widget {
 		 */
 		void HandleGlobalVisibilityChange() override;
 
+		/** Handle style change.
+		 */
+		void HandleStyleChange() override;
+
 		/** Handle update.
 		 */
 		void HandleUpdate( float seconds ) override;
@@ -86,7 +105,23 @@ class SFGUI_API Container : public Widget {
 		void HandleViewportUpdate() override;
 
 	private:
+		typedef std::vector<std::size_t> HitGridCell;
+
+		void UpdateHitGrid();
+		void CollectMouseReceivers( const sf::Event& event, std::vector<std::size_t>& receivers );
+		void AddPathReceiver( Widget::Ptr widget, std::vector<std::size_t>& receivers ) const;
+		Widget::Ptr GetChildOnPath( Widget::Ptr widget ) const;
+
 		WidgetsList m_children;
+
+		std::vector<std::size_t> m_tracking_children;
+
+		std::vector<HitGridCell> m_hit_grid;
+		sf::FloatRect m_hit_grid_bounds;
+		sf::Vector2f m_hit_grid_cell_size;
+		std::size_t m_hit_grid_columns;
+		std::size_t m_hit_grid_rows;
+		bool m_hit_grid_invalid;
 };
 
 }
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <SFGUI/Config.hpp>
+#include <SFGUI/CommandQueue.hpp>
 #include <SFGUI/Context.hpp>
 #include <SFGUI/Engine.hpp>
 
 #include <memory>
 #include <string>
 #include <deque>
+#include <vector>
 
 namespace sf {
 class Event;
@@ -23,6 +25,10 @@ class Widget;
  */
 class SFGUI_API Desktop {
 	public:
+		/** Ctor.
+		 */
+		Desktop();
+
 		/** Use a custom engine.
 		 */
 		template <class T>
@@ -53,15 +59,45 @@ class SFGUI_API Desktop {
 		T GetProperty( const std::string& property, std::shared_ptr<const Widget> widget = std::shared_ptr<const Widget>() ) const;
 
 		/** Update
+		 * Executes posted commands and hands out resources that finished
+		 * loading asynchronously before updating the widgets.
 		 * @param seconds Elapsed time in seconds.
 		 */
 		void Update( float seconds );
 
+		/** Post a command to be executed on the GUI thread.
+		 * This is the only method that may be called from other threads than
+		 * the one updating the desktop. Commands are executed in the order they
+		 * were posted at the start of Update().
+		 * @param command Command, e.g. a lambda function modifying widgets.
+		 */
+		void Post( CommandQueue::Command command );
+
+		/** Set the time that may be spent executing posted commands per Update().
+		 * Commands exceeding the budget are executed during the next Update().
+		 * @param budget Time budget in seconds, 0 to execute all posted commands.
+		 */
+		void SetCommandTimeBudget( float budget );
+
+		/** Get the time that may be spent executing posted commands per Update().
+		 * @return Time budget in seconds, 0 if all posted commands are executed.
+		 */
+		float GetCommandTimeBudget() const;
+
 		/** Handle event.
 		 * @param event SFML event.
 		 */
 		void HandleEvent( const sf::Event& event );
 
+		/** Handle multiple events, e.g. all events polled during a frame.
+		 * Consecutive mouse move events are merged so that only the last
+		 * position is processed, consecutive wheel events of the same wheel
+		 * are merged by summing up their deltas. Events are processed in the
+		 * order given.
+		 * @param events SFML events.
+		 */
+		void HandleEvents( const std::vector<sf::Event>& events );
+
 		/** Add widget.
 		 * The added widget will be the new top widget.
 		 * @param widget Widget.
@@ -104,6 +140,7 @@ class SFGUI_API Desktop {
 
 		void SendFakeMouseMoveEvent( std::shared_ptr<Widget> widget, int x = -1337, int y = -1337 ) const;
 		void RecalculateWidgetLevels();
+		void RaiseWidgetLevel( std::shared_ptr<Widget> widget );
 
 		mutable Context m_context;
 		std::unique_ptr<Engine> m_engine;
@@ -112,6 +149,9 @@ class SFGUI_API Desktop {
 		std::weak_ptr<Widget> m_last_receiver;
 
 		sf::Vector2i m_last_mouse_pos;
+
+		std::unique_ptr<CommandQueue> m_command_queue;
+		float m_command_time_budget;
 };
 
 }
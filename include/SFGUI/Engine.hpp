@@ -2,11 +2,15 @@
 
 #include <SFGUI/Config.hpp>
 #include <SFGUI/ResourceManager.hpp>
+#include <SFGUI/PropertyValue.hpp>
+#include <SFGUI/Atom.hpp>
+#include <SFGUI/AncestorFilter.hpp>
 
 #include <SFML/Config.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <stdexcept>
 #include <memory>
@@ -44,6 +48,10 @@ class SpinButton;
 class Selector;
 class RenderQueue;
 
+namespace priv {
+struct ResolvedStyle;
+}
+
 namespace parser {
 namespace theme {
 struct Rule;
@@ -58,6 +66,28 @@ class SFGUI_API Engine {
 	public:
 		typedef std::runtime_error BadValueException; //<! Thrown when value can't be converted to or from string.
 
+		/** Default property of an engine.
+		 * An aggregate, so engines can keep their defaults in tables that are
+		 * built at compile time and installed with SetDefaultProperties().
+		 */
+		struct DefaultProperty {
+			enum class Type : char {
+				COLOR, //!< color holds 0xRRGGBBAA.
+				FLOAT, //!< number holds the value.
+				INT, //!< integer holds the value.
+				STRING //!< string holds the value.
+			};
+
+			const char* widget; //!< Widget name or "*" for all widgets.
+			const char* state; //!< State or "" for all states.
+			const char* property;
+			Type type;
+			sf::Uint32 color;
+			float number;
+			int integer;
+			const char* string;
+		};
+
 		/** Dtor.
 		 */
 		virtual ~Engine() = default;
@@ -234,6 +264,42 @@ class SFGUI_API Engine {
 		 */
 		bool SetProperty( std::shared_ptr<Selector> selector, const std::string& property, const std::string& value );
 
+		/** Set property.
+		 * The value is stored as is, without formatting and parsing it.
+		 * @param selector Valid selector object.
+		 * @param property Property.
+		 * @param value Color.
+		 * @return true on success, false when: Invalid selector or invalid property.
+		 */
+		bool SetProperty( std::shared_ptr<Selector> selector, const std::string& property, const sf::Color& value );
+
+		/** Set property.
+		 * The value is stored as is, without formatting and parsing it.
+		 * @param selector Valid selector object.
+		 * @param property Property.
+		 * @param value Number.
+		 * @return true on success, false when: Invalid selector or invalid property.
+		 */
+		bool SetProperty( std::shared_ptr<Selector> selector, const std::string& property, float value );
+
+		/** Set property.
+		 * The value is stored as is, without formatting and parsing it.
+		 * @param selector Valid selector object.
+		 * @param property Property.
+		 * @param value Number.
+		 * @return true on success, false when: Invalid selector or invalid property.
+		 */
+		bool SetProperty( std::shared_ptr<Selector> selector, const std::string& property, int value );
+
+		/** Set property.
+		 * The value is stored as is, without formatting and parsing it.
+		 * @param selector Valid selector object.
+		 * @param property Property.
+		 * @param value Number.
+		 * @return true on success, false when: Invalid selector or invalid property.
+		 */
+		bool SetProperty( std::shared_ptr<Selector> selector, const std::string& property, unsigned int value );
+
 		/** Set multiple properties at once.
 		 * @param properties CSS-like rule declarations.
 		 * @return true on success, false when: rule could not be parsed.
@@ -248,7 +314,18 @@ class SFGUI_API Engine {
 		template <typename T>
 		T GetProperty( const std::string& property, std::shared_ptr<const Widget> widget = std::shared_ptr<const Widget>() ) const;
 
+		/** Get property.
+		 * Prefer this over the string overload in frequently run code, the
+		 * property name doesn't have to be interned for every lookup.
+		 * @param property Name of property.
+		 * @param widget Widget to be used for building the property path.
+		 * @return Value or T() in case property doesn't exist.
+		 */
+		template <typename T>
+		T GetProperty( const Atom& property, std::shared_ptr<const Widget> widget = std::shared_ptr<const Widget>() ) const;
+
 		/** Load a theme from file.
+		 * Compiled themes are memory mapped and installed without parsing them.
 		 * @param filename Filename.
 		 * @return true on success, false otherwise.
 		 */
@@ -260,6 +337,22 @@ class SFGUI_API Engine {
 		 */
 		bool LoadThemeFromString( const std::string& data );
 
+		/** Load a theme from memory.
+		 * @param data Theme data, either text or compiled by CompileTheme().
+		 * @param size Size of data.
+		 * @return true on success, false otherwise.
+		 */
+		bool LoadThemeFromMemory( const char* data, std::size_t size );
+
+		/** Compile a theme.
+		 * The compiled theme contains the parsed selectors and typed values and
+		 * can be loaded faster than the theme it was compiled from.
+		 * @param data Theme data.
+		 * @param compiled Receives the compiled theme.
+		 * @return true on success, false when the theme could not be parsed.
+		 */
+		static bool CompileTheme( const std::string& data, std::vector<char>& compiled );
+
 		/** Shift the given border colors to make them lighter and darker.
 		 * @param light_color Color of the lighter border.
 		 * @param dark_color Color of the darker border.
@@ -291,13 +384,72 @@ class SFGUI_API Engine {
 		 */
 		void SetAutoRefresh( bool enable );
 
-	private:
-		typedef std::pair<std::shared_ptr<const Selector>, std::string> SelectorValuePair;
-		typedef std::vector<SelectorValuePair> SelectorValueList;
-		typedef std::map<const std::string, SelectorValueList> WidgetNameMap;
-		typedef std::map<const std::string, WidgetNameMap> PropertyMap;
+		/** Set default properties.
+		 * Selectors and values are built directly, nothing has to be parsed.
+		 * Properties are added in order, later ones win over earlier ones with
+		 * the same selector.
+		 * @param properties Properties.
+		 * @param count Number of properties.
+		 */
+		void SetDefaultProperties( const DefaultProperty* properties, std::size_t count );
 
-		const std::string* GetValue( const std::string& property, std::shared_ptr<const Widget> widget ) const;
+	private:
+		struct Rule {
+			std::shared_ptr<const Selector> selector;
+			priv::PropertyValue value;
+			priv::AncestorFilter ancestors; //!< Entries a widget's ancestors need for the selector to match.
+			int score;
+			bool typed; //!< Selector names a widget, wins over wildcards with equal score.
+			unsigned int serial; //!< Rules set later win over earlier ones with equal score.
+		};
+
+		typedef std::vector<Rule> RuleList;
+
+		/** Rules of a property, bucketed by the most specific part of their
+		 * rightmost simple selector. Only buckets the widget's ID, class,
+		 * name or state point to have to be tested.
+		 */
+		struct Property {
+			std::unordered_map<std::string, RuleList> id_rules;
+			std::unordered_map<std::string, RuleList> class_rules;
+			std::vector<std::pair<Atom, RuleList>> name_rules; //!< Only a handful per property, searched linearly.
+			std::vector<RuleList> state_rules; //!< Indexed by widget state.
+			RuleList universal_rules;
+		};
+
+		typedef std::vector<Property> PropertyList;
+
+		struct StyleChange {
+			std::shared_ptr<const Selector> selector;
+			bool layout; //!< A property that might change requisitions was set.
+		};
+
+		typedef std::vector<StyleChange> StyleChangeList;
+
+		/** Style changes bucketed like the rules of a property, so
+		 * refreshing a widget only tests the changes that can match it.
+		 */
+		struct StyleChangeIndex {
+			std::unordered_map<std::string, StyleChangeList> id_changes;
+			std::unordered_map<std::string, StyleChangeList> class_changes;
+			std::vector<std::pair<Atom, StyleChangeList>> name_changes; //!< Only a handful, searched linearly.
+			StyleChangeList other_changes; //!< State and universal selectors, tested for every widget.
+		};
+
+		const priv::PropertyValue* GetValue( const Atom& property, std::shared_ptr<const Widget> widget ) const;
+		const priv::PropertyValue* FindValue( const Property& property, std::shared_ptr<const Widget> widget, const priv::AncestorFilter& ancestors ) const;
+		RuleList& GetRuleList( Property& property, const Selector& selector );
+		bool AddRule( std::shared_ptr<Selector> selector, const Atom& property, priv::PropertyValue value );
+		bool SetPropertyValue( std::shared_ptr<Selector> selector, const std::string& property, priv::PropertyValue value );
+		std::shared_ptr<Selector> ParseSelector( const std::string& selector );
+		static std::vector<std::shared_ptr<Selector>> CreateSelectors( const parser::theme::Rule& rule );
+
+		static void AddStyleChange( StyleChangeList& changes, std::shared_ptr<const Selector> selector, const Atom& property );
+		void ApplyStyleChanges( const StyleChangeList& changes );
+		void RefreshWidgets( const StyleChangeList& changes ) const;
+		void RefreshWidget( std::shared_ptr<Widget> widget, const StyleChangeIndex& changes ) const;
+		priv::ResolvedStyle& GetResolvedStyle( const Widget& widget ) const;
+		void InvalidateResolvedStyles();
 
 		/** Get maximum line height and baseline offset of a font.
 		 * @param font Font.
@@ -307,8 +459,13 @@ class SFGUI_API Engine {
 		sf::Vector2f GetFontHeightProperties( const sf::Font& font, unsigned int font_size ) const;
 
 		void ParseTheme( const parser::theme::Theme& theme_to_parse );
+		bool LoadCompiledTheme( const char* data, std::size_t size );
 
-		PropertyMap m_properties;
+		PropertyList m_properties; //!< Index of a property is also its index in resolved styles.
+		std::vector<std::size_t> m_property_indices; //!< Indexed by atom ID.
+		std::unordered_map<std::string, std::shared_ptr<Selector>> m_selectors; //!< Selector strings parsed by SetProperty().
+		unsigned int m_style_generation;
+		unsigned int m_rule_serial;
 
 		mutable ResourceManager m_resource_manager;
 
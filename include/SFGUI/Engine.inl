@@ -6,33 +6,35 @@ namespace sfg {
 
 template <typename T>
 T Engine::GetProperty( const std::string& property, std::shared_ptr<const Widget> widget ) const {
+	return GetProperty<T>( Atom( property ), widget );
+}
+
+template <typename T>
+T Engine::GetProperty( const Atom& property, std::shared_ptr<const Widget> widget ) const {
 	static const T default_ = T();
 
-	const std::string* value( GetValue( property, widget ) );
+	const priv::PropertyValue* value( GetValue( property, widget ) );
 	if( !value ) {
 		return default_;
 	}
 
-	// If string is requested, just return the value.
-	if( typeid( T ) == typeid( std::string ) ) {
-		// reinterpret_cast is needed here to fool the compiler. Else it will try
-		// to compile "return *value" for all Ts, which may fail for
-		// GetProperty<int> here, because it would be tried to return a std::string
-		// in this case which fails.
-		return *reinterpret_cast<const T*>( value );
+	// Commonly used types have been converted when the property was set.
+	T out_value;
+
+	if( value->Get( out_value ) ) {
+		return out_value;
 	}
 
 	// Convert value.
-	T out_value;
-	std::istringstream sstr( *value );
+	std::istringstream sstr( value->GetString() );
 	sstr >> out_value;
 
 	if( sstr.fail() ) {
 		std::string error_message( "GetProperty: Unable to convert string to requested type." );
-		error_message += " Property: " + property;
+		error_message += " Property: " + property.GetString();
 		error_message += " Requested type: ";
 		error_message += typeid( T ).name();
-		error_message += " Value: " + *value;
+		error_message += " Value: " + value->GetString();
 		throw BadValueException( error_message );
 	}
 
@@ -41,6 +43,13 @@ T Engine::GetProperty( const std::string& property, std::shared_ptr<const Widget
 
 template <typename T>
 bool Engine::SetProperty( const std::string& selector, const std::string& property, const T& value ) {
+	auto parsed_selector = ParseSelector( selector );
+
+	if( parsed_selector ) {
+		return SetProperty( parsed_selector, property, value );
+	}
+
+	// Grouped or invalid selector, leave it to the theme parser.
 	std::ostringstream properties;
 
 	properties << selector << " {\n\t" << property << ": " << value << ";\n}";
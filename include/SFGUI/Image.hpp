@@ -33,6 +33,16 @@ class SFGUI_API Image : public Widget, public Misc {
 		 */
 		const sf::Image& GetImage() const;
 
+		/** Load sf::Image asynchronously through the resource manager.
+		 * The current image keeps being displayed as a placeholder until loading
+		 * has finished. Setting another image before that cancels the request.
+		 * The image is set when the resource manager hands it out, Desktop does
+		 * that every frame. Without a Desktop, call ResourceManager::Update()
+		 * every frame yourself.
+		 * @param path Path of the image.
+		 */
+		void SetImageAsync( const std::string& path );
+
 	protected:
 		/** Ctor.
 		 * @param image sf::Image.
@@ -45,6 +55,7 @@ class SFGUI_API Image : public Widget, public Misc {
 	private:
 		sf::Image m_image;
 		mutable sf::Vector2f m_texture_offset;
+		unsigned int m_request_serial;
 };
 
 }
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <SFGUI/Container.hpp>
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <functional>
+
+namespace sfg {
+
+class Adjustment;
+
+/** List view.
+ * Displays a possibly huge number of items by only instantiating as many row
+ * widgets as are needed to fill the visible area. Rows are recycled and rebound
+ * to other items when the view is scrolled. The list view is meant to be placed
+ * inside a Viewport, e.g. by using ScrolledWindow::AddWithViewport().
+ */
+class SFGUI_API ListView : public Container {
+	public:
+		typedef std::shared_ptr<ListView> Ptr; //!< Shared pointer.
+		typedef std::shared_ptr<const ListView> PtrConst; //!< Shared pointer.
+
+		typedef std::function<Widget::Ptr()> RowFactory; //!< Creates a new row widget.
+		typedef std::function<void( Widget::Ptr, std::size_t )> RowBinder; //!< Binds a row widget to the item with the given index.
+
+		/** Row height mode.
+		 */
+		enum class RowHeightMode : char {
+			FIXED = 0, //!< All rows have the same height.
+			ESTIMATED //!< Rows are measured once bound, unmeasured rows use the given height.
+		};
+
+		/** Create list view.
+		 * @param factory Function that creates a new row widget.
+		 * @param binder Function that binds a row widget to an item.
+		 * @param row_height Height of a row, or estimated height of a row if mode is ESTIMATED.
+		 * @param mode Row height mode.
+		 * @return List view.
+		 */
+		static Ptr Create( RowFactory factory, RowBinder binder, float row_height, RowHeightMode mode = RowHeightMode::FIXED );
+
+		const std::string& GetName() const override;
+
+		/** Set number of items.
+		 * All row heights are reset and all visible rows are rebound.
+		 * @param count Number of items.
+		 */
+		void SetItemCount( std::size_t count );
+
+		/** Get number of items.
+		 * @return Number of items.
+		 */
+		std::size_t GetItemCount() const;
+
+		/** Set row height.
+		 * All row heights are reset and all visible rows are rebound.
+		 * @param row_height Height of a row, or estimated height of a row if mode is ESTIMATED.
+		 * @param mode Row height mode.
+		 */
+		void SetRowHeight( float row_height, RowHeightMode mode = RowHeightMode::FIXED );
+
+		/** Get row height.
+		 * @return Height of a row, or estimated height of a row if mode is ESTIMATED.
+		 */
+		float GetRowHeight() const;
+
+		/** Get row height mode.
+		 * @return Row height mode.
+		 */
+		RowHeightMode GetRowHeightMode() const;
+
+		/** Rebind the row showing the given item, if it is currently visible.
+		 * @param item Index of the item whose data changed.
+		 */
+		void UpdateItem( std::size_t item );
+
+		/** Rebind all visible rows.
+		 */
+		void UpdateItems();
+
+		/** Get the vertical offset of an item within the list view.
+		 * @param item Index of the item.
+		 * @return Offset of the item's top edge.
+		 */
+		float GetItemOffset( std::size_t item ) const;
+
+		/** Get the item at the given vertical offset within the list view.
+		 * @param offset Vertical offset.
+		 * @return Index of the item, GetItemCount() if the list view is empty.
+		 */
+		std::size_t GetItemAt( float offset ) const;
+
+		/** Used to inform parent that a child's requisition has changed.
+		 * @param child Widget whose requisition changed.
+		 */
+		void HandleChildRequisitionChange( Widget::PtrConst child ) override;
+
+	protected:
+		/** Ctor.
+		 * @param factory Function that creates a new row widget.
+		 * @param binder Function that binds a row widget to an item.
+		 * @param row_height Height of a row, or estimated height of a row if mode is ESTIMATED.
+		 * @param mode Row height mode.
+		 */
+		ListView( RowFactory factory, RowBinder binder, float row_height, RowHeightMode mode );
+
+		sf::Vector2f CalculateRequisition() override;
+
+	private:
+		struct RowInfo {
+			Widget::Ptr widget;
+			std::size_t item;
+
+			RowInfo( Widget::Ptr widget_ );
+		};
+
+		typedef std::vector<RowInfo> RowsCont;
+
+		bool HandleAdd( Widget::Ptr child ) override;
+		void HandleRemove( Widget::Ptr child ) override;
+		void HandleSizeChange() override;
+		void HandleViewportUpdate() override;
+
+		void ConnectAdjustment();
+		bool UpdateView();
+		void UpdateRows();
+		void ResetRows();
+		void ReleaseRow( std::size_t row );
+		void BindRow( RowInfo& row, std::size_t item );
+		void ResetItemHeights();
+		void SetItemHeight( std::size_t item, float height );
+		float GetItemHeight( std::size_t item ) const;
+		float GetTotalHeight() const;
+
+		RowFactory m_factory;
+		RowBinder m_binder;
+
+		RowsCont m_rows;
+		std::deque<std::size_t> m_visible_rows; //!< Rows bound to the visible items, starting at m_first_item.
+		std::vector<std::size_t> m_free_rows;
+		std::size_t m_first_item;
+		std::size_t m_item_count;
+
+		std::weak_ptr<Adjustment> m_adjustment;
+		unsigned int m_adjustment_signal_serial;
+
+		float m_row_height;
+		RowHeightMode m_row_height_mode;
+
+		std::vector<float> m_item_heights;
+		std::vector<float> m_height_tree;
+
+		float m_view_top;
+		float m_view_height;
+
+		bool m_updating_rows;
+		bool m_rows_invalid;
+		bool m_heights_changed;
+};
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <SFGUI/ResourceLoader.hpp>
+
+#include <memory>
+
+namespace sfg {
+
+/** Resource loader for loading from memory mapped files.
+ * Fonts are read by FreeType directly from the mapping, which stays alive as
+ * long as the font does. This avoids keeping a second copy of big font files
+ * on the heap. Images are decoded from the mapping which is released again
+ * afterwards.
+ *
+ * The identifier is "mmap", so paths must begin with "mmap:".
+ */
+class SFGUI_API MappedResourceLoader : public ResourceLoader {
+	public:
+		std::shared_ptr<const sf::Font> LoadFont( const std::string& path ) const override;
+		std::shared_ptr<const sf::Image> LoadImage( const std::string& path ) const override;
+		const std::string& GetIdentifier() const override;
+};
+
+}
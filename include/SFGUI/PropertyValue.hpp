@@ -0,0 +1,111 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <string>
+
+namespace sfg {
+namespace priv {
+
+/** Property value.
+ * The value is converted to the commonly requested types once when the
+ * property is set, so looking it up doesn't have to parse it again. Values
+ * set with one of those types aren't formatted unless the string is needed
+ * or formatting would round them.
+ */
+class SFGUI_API PropertyValue {
+	public:
+		/** Ctor.
+		 * @param string Value as found in the theme.
+		 */
+		explicit PropertyValue( std::string string );
+
+		/** Ctor.
+		 * @param color Color.
+		 */
+		explicit PropertyValue( const sf::Color& color );
+
+		/** Ctor.
+		 * Numbers that would be rounded when formatted are formatted right
+		 * away, the value is then read back from the string.
+		 * @param value Number.
+		 */
+		explicit PropertyValue( float value );
+
+		/** Ctor.
+		 * @param value Number.
+		 */
+		explicit PropertyValue( int value );
+
+		/** Ctor.
+		 * @param value Number.
+		 */
+		explicit PropertyValue( unsigned int value );
+
+		/** Get value as found in the theme or as it would be written to one.
+		 * @return Value string.
+		 */
+		const std::string& GetString() const;
+
+		/** Get value as string.
+		 * @param out Receives the value.
+		 * @return true.
+		 */
+		bool Get( std::string& out ) const;
+
+		/** Get value as color.
+		 * @param out Receives the value.
+		 * @return true if the value is a color.
+		 */
+		bool Get( sf::Color& out ) const;
+
+		/** Get value as float.
+		 * @param out Receives the value.
+		 * @return true if the value is a number.
+		 */
+		bool Get( float& out ) const;
+
+		/** Get value as int.
+		 * @param out Receives the value.
+		 * @return true if the value is an integer.
+		 */
+		bool Get( int& out ) const;
+
+		/** Get value as unsigned int.
+		 * @param out Receives the value.
+		 * @return true if the value is an unsigned integer.
+		 */
+		bool Get( unsigned int& out ) const;
+
+		/** Get value as any other type.
+		 * Other types aren't converted in advance, the caller has to parse the string.
+		 * @return false.
+		 */
+		template <typename T>
+		bool Get( T& ) const {
+			return false;
+		}
+
+	private:
+		enum Type : unsigned char {
+			COLOR = 1 << 0,
+			FLOAT = 1 << 1,
+			INT = 1 << 2,
+			UNSIGNED_INT = 1 << 3,
+			STRING = 1 << 4
+		};
+
+		mutable std::string m_string;
+
+		sf::Color m_color;
+		float m_float;
+		int m_int;
+		unsigned int m_unsigned_int;
+
+		mutable unsigned char m_types; //!< Types the value could be converted to.
+		unsigned char m_source; //!< Type the value was set as.
+};
+
+}
+}
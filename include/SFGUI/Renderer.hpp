@@ -218,6 +218,13 @@ class SFGUI_API Renderer {
 		 */
 		void Invalidate( unsigned char datasets = INVALIDATE_ALL );
 
+		/** Inform the renderer that the layer or level of primitives changed.
+		 * Primitives will be sorted again before the next sync. Only the index
+		 * data is rebuilt, vertex, color and texture data are left alone.
+		 * Calling this several times before the next sync costs a single sort.
+		 */
+		void InvalidatePrimitiveOrder();
+
 		/** Draw the GUI to an sf::Window.
 		 * @param target sf::Window to draw to.
 		 */
@@ -269,6 +276,13 @@ class SFGUI_API Renderer {
 
 		void SortPrimitives();
 
+		/** Check if a primitive has to be drawn before another one.
+		 * @param first First primitive.
+		 * @param second Second primitive.
+		 * @return true if first has to be drawn before second.
+		 */
+		static bool IsDrawnBefore( const Primitive& first, const Primitive& second );
+
 		int GetMaxTextureSize() const;
 
 		void WipeStateCache( sf::RenderTarget& target ) const;
@@ -13,6 +13,7 @@ namespace sfg {
 
 namespace priv {
 struct RendererBatch;
+struct RendererSpan;
 }
 
 /** SFGUI Vertex Buffer renderer.
@@ -77,6 +78,10 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 
 		void RefreshVBO();
 
+		void RefreshVertices();
+
+		void RefreshIndices();
+
 		void SetupFBO( int width, int height );
 
 		void DestroyFBO();
@@ -90,6 +95,7 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 		std::vector<unsigned int> m_index_data;
 
 		std::vector<priv::RendererBatch> m_batches;
+		std::vector<priv::RendererSpan> m_spans;
 
 		unsigned int m_frame_buffer = 0;
 		unsigned int m_frame_buffer_texture = 0;
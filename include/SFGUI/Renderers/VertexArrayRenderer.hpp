@@ -12,6 +12,7 @@ namespace sfg {
 
 namespace priv {
 struct RendererBatch;
+struct RendererSpan;
 }
 
 /** SFGUI Vertex Array renderer.
@@ -65,18 +66,25 @@ class SFGUI_API VertexArrayRenderer : public Renderer {
 
 		void RefreshArray();
 
+		void RefreshVertices();
+
+		void RefreshIndices();
+
 		std::vector<sf::Vector2f> m_vertex_data;
 		std::vector<sf::Color> m_color_data;
 		std::vector<sf::Vector2f> m_texture_data;
 		std::vector<int> m_index_data;
 
 		std::vector<priv::RendererBatch> m_batches;
+		std::vector<priv::RendererSpan> m_spans;
 
 		int m_last_vertex_count;
 		int m_last_index_count;
 
 		float m_alpha_threshold;
 
+		unsigned char m_sync_type;
+
 		mutable bool m_dirty;
 
 		bool m_cull;
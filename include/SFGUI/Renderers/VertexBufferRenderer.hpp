@@ -12,6 +12,7 @@ namespace sfg {
 
 namespace priv {
 struct RendererBatch;
+struct RendererSpan;
 }
 
 /** SFGUI Vertex Buffer renderer.
@@ -81,6 +82,10 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 
 		void RefreshVBO();
 
+		void RefreshVertices();
+
+		void RefreshIndices();
+
 		void SetupFBO( int width, int height );
 
 		void DestroyFBO();
@@ -91,6 +96,7 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 		std::vector<unsigned int> m_index_data;
 
 		std::vector<priv::RendererBatch> m_batches;
+		std::vector<priv::RendererSpan> m_spans;
 
 		unsigned int m_frame_buffer;
 		unsigned int m_frame_buffer_texture;
@@ -18,6 +18,9 @@ namespace sfg {
  * plain files.
  *
  * All returned objects have to be unmanaged.
+ *
+ * Loaders are also used by worker threads when loading asynchronously, so
+ * LoadFont() and LoadImage() must be safe to call concurrently.
  */
 class SFGUI_API ResourceLoader {
 	public:
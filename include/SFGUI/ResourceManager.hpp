@@ -3,8 +3,16 @@
 #include <SFGUI/Config.hpp>
 
 #include <map>
+#include <list>
+#include <deque>
+#include <vector>
 #include <string>
 #include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
 
 namespace sf {
 class Font;
@@ -21,15 +29,40 @@ class ResourceLoader;
  * resource managers to support multiple sources (file, ZIP, whatever). Paths
  * must have the correct loader prefix. In case of loading from files, a prefix
  * is not needed. E.g. for loading from ZIP files, a loader may have the prefix
- * "zip", so paths must begin with "zip:".
+ * "zip", so paths must begin with "zip:". Files can also be loaded through
+ * memory mappings by using the "mmap:" prefix.
+ *
+ * Resources can also be loaded asynchronously. Loading then happens on a pool
+ * of worker threads and the results are handed out on the GUI thread once
+ * Update() is called. Desktop does that every frame, without a Desktop call
+ * Update() once every frame yourself.
  */
 class SFGUI_API ResourceManager {
 	public:
+		typedef std::function<void( std::shared_ptr<const sf::Font> )> FontCallback; //!< Called with a font that finished loading.
+		typedef std::function<void( std::shared_ptr<const sf::Image> )> ImageCallback; //!< Called with an image that finished loading.
+
+		/** Cache statistics.
+		 */
+		struct Statistics {
+			std::size_t font_hits; //!< Font requests served from the cache.
+			std::size_t font_misses; //!< Font requests that had to load.
+			std::size_t image_hits; //!< Image requests served from the cache.
+			std::size_t image_misses; //!< Image requests that had to load.
+			std::size_t image_evictions; //!< Images dropped to stay within the budget.
+			std::size_t image_bytes; //!< Pixel data of all cached images.
+		};
+
 		/** Ctor.
 		 * @param use_default_font Use SFML's default font if custom font fails to load.
 		 */
 		ResourceManager( bool use_default_font = true );
 
+		/** Dtor.
+		 * Waits for loads that are currently in progress.
+		 */
+		~ResourceManager();
+
 		/** Clear manager, i.e. destroy all resources and loaders.
 		 */
 		void Clear();
@@ -46,6 +79,13 @@ class SFGUI_API ResourceManager {
 		 */
 		std::shared_ptr<const ResourceLoader> GetLoader( const std::string& id );
 
+		/** Add a loader.
+		 * Use this for loaders that need to be constructed with arguments.
+		 * A loader with the same identifier will be replaced.
+		 * @param loader Loader to add.
+		 */
+		void AddLoader( std::shared_ptr<const ResourceLoader> loader );
+
 		/** Get font.
 		 * Will be loaded if not done so before.
 		 * @param path Path.
@@ -60,6 +100,32 @@ class SFGUI_API ResourceManager {
 		 */
 		std::shared_ptr<const sf::Image> GetImage( const std::string& path );
 
+		/** Load font asynchronously.
+		 * The font is loaded on a worker thread, the callback is called from
+		 * within Update() once it is done. If the font has already been loaded,
+		 * the callback is called immediately. Failing to load falls back to the
+		 * default font just like GetFont() does.
+		 * @param path Path.
+		 * @param callback Function to call with the font.
+		 */
+		void GetFontAsync( const std::string& path, FontCallback callback );
+
+		/** Load image asynchronously.
+		 * The image is loaded on a worker thread, the callback is called from
+		 * within Update() once it is done. If the image has already been loaded,
+		 * the callback is called immediately.
+		 * @param path Path.
+		 * @param callback Function to call with the image or std::shared_ptr<const sf::Image>() if failed to load.
+		 */
+		void GetImageAsync( const std::string& path, ImageCallback callback );
+
+		/** Hand out resources that finished loading asynchronously.
+		 * Must be called from the GUI thread every frame. Desktop::Update() does
+		 * this for you.
+		 * @return Number of finished loads.
+		 */
+		std::size_t Update();
+
 		/** Add font.
 		 * A resource with the same path will be replaced.
 		 * @param path Path (or ID or whatever).
@@ -80,17 +146,78 @@ class SFGUI_API ResourceManager {
 		 */
 		void SetDefaultFont( std::shared_ptr<const sf::Font> font );
 
+		/** Set the number of bytes cached images may occupy.
+		 * When exceeded, the least recently used images that are not referenced
+		 * anywhere else are dropped from the cache. Images still in use are kept
+		 * even if that means staying above the budget for a while.
+		 * @param bytes Budget in bytes, 0 for unlimited (default).
+		 */
+		void SetImageBudget( std::size_t bytes );
+
+		/** Get the number of bytes cached images may occupy.
+		 * @return Budget in bytes, 0 for unlimited.
+		 */
+		std::size_t GetImageBudget() const;
+
+		/** Get cache statistics.
+		 * @return Statistics.
+		 */
+		const Statistics& GetStatistics() const;
+
+		/** Reset hit, miss and eviction counters.
+		 */
+		void ResetStatistics();
+
 	private:
+		typedef std::list<const std::string*> ImageUseList; //!< Paths of cached images, most recently used first.
+
+		struct ImageEntry {
+			std::shared_ptr<const sf::Image> image;
+			std::weak_ptr<const sf::Image> handed_out; //!< Shares image, notifies the manager when released.
+			std::size_t bytes;
+			ImageUseList::iterator use;
+		};
+
 		typedef std::map<const std::string, std::shared_ptr<const ResourceLoader>> LoaderMap;
 		typedef std::map<const std::string, std::shared_ptr<const sf::Font>> FontMap;
-		typedef std::map<const std::string, std::shared_ptr<const sf::Image>> ImageMap;
+		typedef std::map<const std::string, ImageEntry> ImageMap;
+		typedef std::map<const std::string, std::vector<FontCallback>> FontCallbackMap;
+		typedef std::map<const std::string, std::vector<ImageCallback>> ImageCallbackMap;
+		typedef std::function<void()> Job;
 
 		std::shared_ptr<const ResourceLoader> GetMatchingLoader( const std::string& path );
 		std::string GetFilename( const std::string& path, const ResourceLoader& loader );
 
+		std::shared_ptr<const sf::Font> LoadFont( const std::string& path );
+		std::shared_ptr<const sf::Font> GetDefaultFont();
+
+		void PushJob( Job job );
+		void RunWorker();
+		void FinishFont( const std::string& path, std::shared_ptr<const sf::Font> font );
+		void FinishImage( const std::string& path, std::shared_ptr<const sf::Image> image );
+
+		std::shared_ptr<const sf::Image> UseImage( ImageEntry& entry );
+		ImageEntry& CacheImage( const std::string& path, std::shared_ptr<const sf::Image> image );
+		void EvictImages();
+
 		LoaderMap m_loaders;
 		FontMap m_fonts;
 		ImageMap m_images;
+		ImageUseList m_image_uses;
+		std::shared_ptr<std::atomic<bool>> m_image_released; //!< Set when an image handed out is no longer used.
+
+		Statistics m_statistics;
+		std::size_t m_image_budget;
+
+		FontCallbackMap m_font_callbacks;
+		ImageCallbackMap m_image_callbacks;
+
+		std::vector<std::thread> m_workers;
+		std::deque<Job> m_jobs; //!< Loads waiting for a worker.
+		std::vector<Job> m_finished_jobs; //!< Results waiting for Update().
+		std::mutex m_jobs_mutex;
+		std::condition_variable m_jobs_condition;
+		bool m_stop_workers;
 
 		bool m_use_default_font;
 };
@@ -2,6 +2,7 @@
 
 #include <SFGUI/Config.hpp>
 #include <SFGUI/Widget.hpp>
+#include <SFGUI/Atom.hpp>
 
 #include <memory>
 #include <string>
@@ -41,6 +42,11 @@ class SFGUI_API Selector {
 		 */
 		const std::string& GetWidgetName() const;
 
+		/** Get widget name as atom.
+		 * @return Widget name or empty if all.
+		 */
+		const Atom& GetWidgetNameAtom() const;
+
 		/** Get ID.
 		 * @return ID or empty if all.
 		 */
@@ -100,7 +106,7 @@ class SFGUI_API Selector {
 
 		HierarchyType m_hierarchy_type;
 
-		std::string m_widget;
+		Atom m_widget;
 		std::string m_id;
 		std::string m_class;
 		std::unique_ptr<Widget::State> m_state;
@@ -2,8 +2,9 @@
 
 #include <SFGUI/Config.hpp>
 
-#include <map>
 #include <memory>
+#include <vector>
+#include <utility>
 #include <functional>
 
 namespace sfg {
@@ -21,6 +22,9 @@ namespace sfg {
  * widget->OnLeftClick.Connect( [object] { object->MyCallback(); } ); // Method binding via lambda function.
  * \endcode
  *
+ * Delegates are called in the order they were connected. Delegates connected
+ * while the signal is being emitted will be called starting with the next
+ * emission.
  */
 class SFGUI_API Signal {
 	public:
@@ -54,9 +58,29 @@ class SFGUI_API Signal {
 		static SignalID GetGUID();
 
 	private:
-		typedef std::map<unsigned int, std::function<void()>> DelegateMap;
+		struct Delegate {
+			unsigned int serial; ///< 0 if the delegate has been disconnected.
+			std::function<void()> function;
 
-		std::unique_ptr<DelegateMap> m_delegates;
+			Delegate( unsigned int serial_, std::function<void()> function_ );
+		};
+
+		typedef std::vector<Delegate> DelegateList;
+
+		// Kept on the heap so it stays in place if the signal
+		// is moved while one of its delegates is running.
+		struct Delegates {
+			DelegateList active;
+			DelegateList pending; ///< Connected during emission.
+			unsigned int emitting;
+			bool has_tombstones;
+
+			Delegates();
+		};
+
+		static void Flush( Delegates& delegates );
+
+		std::unique_ptr<Delegates> m_delegates;
 };
 
 /** Widget signal container
@@ -77,9 +101,9 @@ class SFGUI_API SignalContainer {
 		void Emit( const Signal::SignalID& id );
 
 	private:
-		typedef std::map<Signal::SignalID, Signal> SignalMap;
+		typedef std::vector<std::pair<Signal::SignalID, Signal>> SignalList;
 
-		std::unique_ptr<SignalMap> m_signals;
+		SignalList m_signals;
 };
 
 }
@@ -6,6 +6,7 @@
 
 #include <list>
 #include <vector>
+#include <unordered_map>
 #include <memory>
 #include <cstdint>
 
@@ -65,28 +66,50 @@ class SFGUI_API Table : public Container {
 		 */
 		void SetRowSpacings( float spacing );
 
+		/** Used to inform parent that a child's requisition has changed.
+		 * @param child Widget whose requisition changed.
+		 */
+		void HandleChildRequisitionChange( Widget::PtrConst child ) override;
+
 	protected:
 		/** Ctor.
 		 */
-		Table() = default;
+		Table();
 
 	private:
 		typedef std::list<priv::TableCell> TableCellList;
 		typedef std::vector<priv::TableOptions> TableOptionsArray;
+		typedef std::unordered_map<const Widget*, TableCellList::iterator> TableCellMap;
+		typedef std::vector<priv::TableCell*> TableCellPtrArray;
 
 		sf::Vector2f CalculateRequisition() override;
 		void UpdateRequisitions();
+		void UpdateColumnRequisition( std::size_t index );
+		void UpdateRowRequisition( std::size_t index );
 		void AllocateChildren();
+		void AllocateCell( const priv::TableCell& cell ) const;
+		void InvalidateColumn( std::size_t index );
+		void InvalidateRow( std::size_t index );
+		void InvalidateCell( priv::TableCell& cell );
+		void InvalidateLayout();
 
 		void HandleSizeChange() override;
 		void HandleRequisitionChange() override;
 		void HandleRemove( Widget::Ptr child ) override;
 
 		TableCellList m_cells;
+		TableCellMap m_cell_map;
 		TableOptionsArray m_columns;
 		TableOptionsArray m_rows;
 
+		std::vector<std::size_t> m_dirty_columns;
+		std::vector<std::size_t> m_dirty_rows;
+		TableCellPtrArray m_dirty_cells;
+
 		sf::Vector2f m_general_spacings;
+
+		bool m_requisitions_invalid;
+		bool m_allocations_invalid;
 };
 
 }
@@ -30,6 +30,7 @@ class TableCell {
 		int x_options;
 		int y_options;
 		sf::Vector2f padding;
+		bool pending_allocation; ///< Queued for reallocation?
 };
 
 }
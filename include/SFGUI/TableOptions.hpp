@@ -1,8 +1,12 @@
 #pragma once
 
+#include <vector>
+
 namespace sfg {
 namespace priv {
 
+class TableCell;
+
 /** Options for a table row or column.
  */
 class TableOptions {
@@ -16,6 +20,8 @@ class TableOptions {
 		float allocation; ///< Allocation (width or height).
 		float spacing; ///< Spacing.
 		bool expand; ///< Expand row/column?
+		bool dirty; ///< Requisition needs to be recalculated?
+		std::vector<TableCell*> cells; ///< Cells spanning this row/column.
 };
 
 }
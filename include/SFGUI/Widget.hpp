@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFGUI/Object.hpp>
+#include <SFGUI/Atom.hpp>
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Window/Mouse.hpp>
@@ -17,9 +18,14 @@ class Event;
 namespace sfg {
 
 class Container;
+class Engine;
 class RendererViewport;
 class RenderQueue;
 
+namespace priv {
+struct ResolvedStyle;
+}
+
 /** Base class for widgets.
  */
 class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widget> {
@@ -67,6 +73,11 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		virtual const std::string& GetName() const = 0;
 
+		/** Get name of widget as atom.
+		 * @return Name.
+		 */
+		const Atom& GetNameAtom() const;
+
 		/** Grab focus.
 		 */
 		void GrabFocus();
@@ -189,6 +200,11 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		virtual void HandleGlobalVisibilityChange();
 
+		/** Handle changes that might affect which properties apply to this widget.
+		 * Discards the properties the engine looked up for it so far.
+		 */
+		virtual void HandleStyleChange();
+
 		/** Update position of drawable.
 		 */
 		virtual void UpdateDrawablePosition() const;
@@ -215,15 +231,16 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		std::string GetClass() const;
 
-		/** Get all widgets with the specified ID.
+		/** Get the widget with the specified ID.
+		 * If multiple widgets share the same ID, any one of them is returned.
 		 * @param id ID the widget should have.
-		 * @return Widget::Ptr of the first found widget with the specified ID or Widget::Ptr() if none found.
+		 * @return Widget::Ptr of the found widget with the specified ID or Widget::Ptr() if none found.
 		 */
 		static Widget::Ptr GetWidgetById( const std::string& id );
 
 		/** Get all widgets with the specified class.
 		 * @param class_name Class the widget should have.
-		 * @return sfg::Widget::WidgetsList of all found widgets with the specified class. Empty if none found.
+		 * @return sfg::Widget::WidgetsList of all found widgets with the specified class in no particular order. Empty if none found.
 		 */
 		static WidgetsList GetWidgetsByClass( const std::string& class_name );
 
@@ -449,7 +466,32 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		bool IsModal() const;
 
+		/** Get the focused widget.
+		 * @return Focused widget or nullptr if no widget has focus.
+		 */
+		static Ptr GetFocusWidget();
+
+		/** Get the active widget.
+		 * @return Active widget or nullptr if no widget is active.
+		 */
+		static Ptr GetActiveWidget();
+
+		/** Get the modal widget.
+		 * @return Modal widget or nullptr if no widget is modal.
+		 */
+		static Ptr GetModalWidget();
+
+		/** Check if a widget has to keep receiving mouse events that happen outside of its allocation.
+		 * This is the case while the mouse is inside of it or a mouse button is held down on it.
+		 * @param widget Checked widget.
+		 * @return true if widget is tracking the mouse.
+		 */
+		static bool IsTrackingMouse( PtrConst widget );
+
 	private:
+		// The engine caches looked up properties in m_style.
+		friend class Engine;
+
 		struct ClassId {
 			std::string id;
 			std::string class_;
@@ -460,6 +502,9 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 
 		static const std::vector<Widget*>& GetRootWidgets();
 
+		void RegisterRootWidget();
+		void UnregisterRootWidget();
+
 		sf::FloatRect m_allocation;
 		sf::Vector2f m_requisition;
 		std::unique_ptr<sf::Vector2f> m_custom_requisition;
@@ -473,8 +518,13 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		int m_hierarchy_level;
 		int m_z_order;
 
+		std::size_t m_root_index;
+
 		mutable std::unique_ptr<RenderQueue> m_drawable;
 
+		mutable std::shared_ptr<priv::ResolvedStyle> m_style;
+		mutable Atom m_name_atom;
+
 		mutable bool m_invalidated;
 		mutable bool m_parent_notified;
 
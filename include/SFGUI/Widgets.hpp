@@ -19,6 +19,7 @@
 #include <SFGUI/Frame.hpp>
 #include <SFGUI/Image.hpp>
 #include <SFGUI/Label.hpp>
+#include <SFGUI/ListView.hpp>
 #include <SFGUI/Notebook.hpp>
 #include <SFGUI/ProgressBar.hpp>
 #include <SFGUI/RadioButton.hpp>
@@ -0,0 +1,55 @@
+#include <SFGUI/AncestorFilter.hpp>
+#include <SFGUI/Atom.hpp>
+
+#include <functional>
+#include <initializer_list>
+
+namespace {
+
+// Keep names, IDs and classes with the same spelling apart.
+const std::size_t id_salt = 0x5bd1e995;
+const std::size_t class_salt = 0x1b873593;
+
+}
+
+namespace sfg {
+namespace priv {
+
+AncestorFilter::AncestorFilter() {
+	for( auto& word : m_bits ) {
+		word = 0;
+	}
+}
+
+void AncestorFilter::AddName( const Atom& name ) {
+	// Atom IDs are small, spread them before taking bits from them.
+	Add( static_cast<std::size_t>( name.GetId() ) * 0x9e3779b9 );
+}
+
+void AncestorFilter::AddId( const std::string& id ) {
+	Add( std::hash<std::string>()( id ) ^ id_salt );
+}
+
+void AncestorFilter::AddClass( const std::string& class_ ) {
+	Add( std::hash<std::string>()( class_ ) ^ class_salt );
+}
+
+bool AncestorFilter::MightContain( const AncestorFilter& other ) const {
+	for( std::size_t index = 0; index < word_count; ++index ) {
+		if( ( m_bits[index] & other.m_bits[index] ) != other.m_bits[index] ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AncestorFilter::Add( std::size_t hash ) {
+	// Two bits per entry out of 256.
+	for( auto bit : { hash & 0xff, ( hash >> 8 ) & 0xff } ) {
+		m_bits[bit / 64] |= std::uint64_t( 1 ) << ( bit % 64 );
+	}
+}
+
+}
+}
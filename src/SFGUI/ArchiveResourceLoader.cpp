@@ -0,0 +1,183 @@
+#include <SFGUI/ArchiveResourceLoader.hpp>
+#include <SFGUI/ResourceArchive.hpp>
+#include <SFGUI/MappedFile.hpp>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// sf::Font only references the memory it was loaded from,
+// so the archive has to stay mapped as long as the font lives.
+struct ArchiveFont {
+	ArchiveFont( std::shared_ptr<const sfg::priv::MappedFile> file_ ) :
+		file( file_ )
+	{
+	}
+
+	std::shared_ptr<const sfg::priv::MappedFile> file;
+	sf::Font font;
+};
+
+std::uint32_t GetField( const char* entry, sfg::priv::archive::EntryField field ) {
+	return sfg::priv::archive::Read( entry + field * 4 );
+}
+
+// Same order as std::string's operator<, which the packer sorts by.
+int CompareNames( const char* first, std::size_t first_length, const char* second, std::size_t second_length ) {
+	auto result = std::memcmp( first, second, std::min( first_length, second_length ) );
+
+	if( result || ( first_length == second_length ) ) {
+		return result;
+	}
+
+	return first_length < second_length ? -1 : 1;
+}
+
+}
+
+namespace sfg {
+
+ArchiveResourceLoader::ArchiveResourceLoader( const std::string& path, const std::string& identifier ) :
+	m_file( std::make_shared<priv::MappedFile>( path ) ),
+	m_identifier( identifier ),
+	m_entry_count( 0 )
+{
+	if( !Validate() ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Couldn't open the resource archive \"" << path << "\".\n";
+#endif
+		m_file.reset();
+		m_entry_count = 0;
+	}
+}
+
+bool ArchiveResourceLoader::IsOpen() const {
+	return m_file != nullptr;
+}
+
+std::shared_ptr<const sf::Font> ArchiveResourceLoader::LoadFont( const std::string& path ) const {
+	auto entry = FindEntry( path );
+
+	if( !entry || ( GetField( entry, priv::archive::TYPE ) != priv::archive::RAW ) ) {
+		return std::shared_ptr<const sf::Font>();
+	}
+
+	auto archive_font = std::make_shared<ArchiveFont>( m_file );
+
+	if( !archive_font->font.loadFromMemory( m_file->GetData() + GetField( entry, priv::archive::DATA_OFFSET ), GetField( entry, priv::archive::DATA_SIZE ) ) ) {
+		return std::shared_ptr<const sf::Font>();
+	}
+
+	return std::shared_ptr<const sf::Font>( archive_font, &archive_font->font );
+}
+
+std::shared_ptr<const sf::Image> ArchiveResourceLoader::LoadImage( const std::string& path ) const {
+	auto entry = FindEntry( path );
+
+	if( !entry ) {
+		return std::shared_ptr<const sf::Image>();
+	}
+
+	auto data = m_file->GetData() + GetField( entry, priv::archive::DATA_OFFSET );
+	auto image = std::make_shared<sf::Image>();
+
+	if( GetField( entry, priv::archive::TYPE ) == priv::archive::RGBA ) {
+		image->create( GetField( entry, priv::archive::WIDTH ), GetField( entry, priv::archive::HEIGHT ), reinterpret_cast<const sf::Uint8*>( data ) );
+	}
+	else if( !image->loadFromMemory( data, GetField( entry, priv::archive::DATA_SIZE ) ) ) {
+		return std::shared_ptr<const sf::Image>();
+	}
+
+	return image;
+}
+
+const std::string& ArchiveResourceLoader::GetIdentifier() const {
+	return m_identifier;
+}
+
+bool ArchiveResourceLoader::Validate() {
+	if( !m_file->IsOpen() || ( m_file->GetSize() < priv::archive::header_size ) ) {
+		return false;
+	}
+
+	auto data = m_file->GetData();
+	auto size = m_file->GetSize();
+
+	if( std::memcmp( data, priv::archive::magic, sizeof( priv::archive::magic ) ) || ( priv::archive::Read( data + 4 ) != priv::archive::version ) ) {
+		return false;
+	}
+
+	std::size_t entry_count = priv::archive::Read( data + 8 );
+
+	if( entry_count > ( size - priv::archive::header_size ) / priv::archive::entry_size ) {
+		return false;
+	}
+
+	// Check everything once so lookups don't have to.
+	const char* previous_name = nullptr;
+	std::size_t previous_length = 0;
+
+	for( std::size_t index = 0; index < entry_count; ++index ) {
+		auto entry = data + priv::archive::header_size + index * priv::archive::entry_size;
+
+		std::size_t name_offset = GetField( entry, priv::archive::NAME_OFFSET );
+		std::size_t name_length = GetField( entry, priv::archive::NAME_LENGTH );
+		std::size_t data_offset = GetField( entry, priv::archive::DATA_OFFSET );
+		std::size_t data_size = GetField( entry, priv::archive::DATA_SIZE );
+
+		if( ( name_offset > size ) || ( name_length > size - name_offset ) || ( data_offset > size ) || ( data_size > size - data_offset ) ) {
+			return false;
+		}
+
+		if( ( GetField( entry, priv::archive::TYPE ) == priv::archive::RGBA ) &&
+		    ( static_cast<std::size_t>( GetField( entry, priv::archive::WIDTH ) ) * GetField( entry, priv::archive::HEIGHT ) * 4 != data_size ) ) {
+			return false;
+		}
+
+		// Names have to be sorted for the binary search.
+		if( previous_name && ( CompareNames( previous_name, previous_length, data + name_offset, name_length ) >= 0 ) ) {
+			return false;
+		}
+
+		previous_name = data + name_offset;
+		previous_length = name_length;
+	}
+
+	m_entry_count = entry_count;
+
+	return true;
+}
+
+const char* ArchiveResourceLoader::FindEntry( const std::string& name ) const {
+	if( !m_file ) {
+		return nullptr;
+	}
+
+	auto data = m_file->GetData();
+
+	std::size_t first = 0;
+	std::size_t last = m_entry_count;
+
+	while( first < last ) {
+		auto middle = first + ( last - first ) / 2;
+		auto entry = data + priv::archive::header_size + middle * priv::archive::entry_size;
+		auto result = CompareNames( data + GetField( entry, priv::archive::NAME_OFFSET ), GetField( entry, priv::archive::NAME_LENGTH ), name.data(), name.size() );
+
+		if( result < 0 ) {
+			first = middle + 1;
+		}
+		else if( result > 0 ) {
+			last = middle;
+		}
+		else {
+			return entry;
+		}
+	}
+
+	return nullptr;
+}
+
+}
@@ -0,0 +1,67 @@
+#include <SFGUI/Atom.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct AtomTable {
+	std::unordered_map<std::string, unsigned int> ids;
+	std::vector<const std::string*> strings; //!< Keys of ids, indexed by ID.
+
+	AtomTable() {
+		strings.push_back( &ids.emplace( std::string(), 0 ).first->first );
+	}
+};
+
+// Atoms are commonly created during static initialization,
+// so the table has to be constructed on first use.
+AtomTable& GetAtomTable() {
+	static AtomTable table;
+	return table;
+}
+
+}
+
+namespace sfg {
+
+Atom::Atom() :
+	m_id( 0 )
+{
+}
+
+Atom::Atom( const std::string& string ) {
+	auto& table = GetAtomTable();
+	auto iter = table.ids.find( string );
+
+	if( iter == table.ids.end() ) {
+		iter = table.ids.emplace( string, static_cast<unsigned int>( table.strings.size() ) ).first;
+
+		// Node based, the key will stay where it is.
+		table.strings.push_back( &iter->first );
+	}
+
+	m_id = iter->second;
+}
+
+const std::string& Atom::GetString() const {
+	return *GetAtomTable().strings[m_id];
+}
+
+unsigned int Atom::GetId() const {
+	return m_id;
+}
+
+bool Atom::operator==( const Atom& other ) const {
+	return m_id == other.m_id;
+}
+
+bool Atom::operator!=( const Atom& other ) const {
+	return m_id != other.m_id;
+}
+
+bool Atom::operator<( const Atom& other ) const {
+	return m_id < other.m_id;
+}
+
+}
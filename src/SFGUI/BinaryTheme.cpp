@@ -0,0 +1,363 @@
+#include <SFGUI/Engine.hpp>
+#include <SFGUI/Selector.hpp>
+#include <SFGUI/BinaryTheme.hpp>
+#include <SFGUI/Parsers/ThemeParser/Parse.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <limits>
+#include <utility>
+#include <cstring>
+
+namespace {
+
+namespace binary_theme = sfg::priv::binary_theme;
+
+static_assert( sizeof( float ) == 4, "Compiled themes store floats as 32 bit numbers." );
+
+typedef std::array<std::uint32_t, 6> SelectorEntry;
+typedef std::array<std::uint32_t, 4> RuleEntry;
+
+class ThemeCompiler {
+	public:
+		std::uint32_t AddString( const std::string& string ) {
+			auto iter = m_string_indices.find( string );
+
+			if( iter != m_string_indices.end() ) {
+				return iter->second;
+			}
+
+			auto index = static_cast<std::uint32_t>( m_strings.size() );
+
+			m_strings.push_back( string );
+			m_string_indices.emplace( string, index );
+
+			return index;
+		}
+
+		std::uint32_t AddSelector( const sfg::parser::theme::SimpleSelector& simple_selector, sfg::Selector::HierarchyType hierarchy, std::uint32_t parent ) {
+			// Let invalid states fail now instead of when loading.
+			sfg::Selector::Create( "", "", "", simple_selector.m_state_selector, sfg::Selector::HierarchyType::ROOT, sfg::Selector::Ptr() );
+
+			SelectorEntry entry = { {
+				AddString( simple_selector.m_type_selector ),
+				AddString( simple_selector.m_id_selector ),
+				AddString( simple_selector.m_class_selector ),
+				AddString( simple_selector.m_state_selector ),
+				static_cast<std::uint32_t>( hierarchy ),
+				( hierarchy == sfg::Selector::HierarchyType::ROOT ) ? binary_theme::no_parent : parent
+			} };
+
+			// Rules often share selectors or their parents.
+			auto iter = m_selector_indices.find( entry );
+
+			if( iter != m_selector_indices.end() ) {
+				return iter->second;
+			}
+
+			auto index = static_cast<std::uint32_t>( m_selectors.size() );
+
+			m_selectors.push_back( entry );
+			m_selector_indices.emplace( entry, index );
+
+			return index;
+		}
+
+		void AddRule( std::uint32_t selector, const std::string& property, const std::string& value ) {
+			RuleEntry entry = { { selector, AddString( property ), binary_theme::STRING, 0 } };
+
+			// Only store typed values that read exactly like the string would.
+			sfg::priv::PropertyValue parsed( value );
+
+			sf::Color color_value;
+			int int_value;
+			unsigned int unsigned_int_value;
+			float float_value;
+
+			if( parsed.Get( color_value ) && ( sfg::priv::PropertyValue( color_value ).GetString() == value ) ) {
+				entry[binary_theme::VALUE_TYPE] = binary_theme::COLOR;
+				entry[binary_theme::VALUE] =
+					static_cast<std::uint32_t>( color_value.r ) |
+					static_cast<std::uint32_t>( color_value.g ) << 8 |
+					static_cast<std::uint32_t>( color_value.b ) << 16 |
+					static_cast<std::uint32_t>( color_value.a ) << 24;
+			}
+			else if( parsed.Get( int_value ) && ( sfg::priv::PropertyValue( int_value ).GetString() == value ) ) {
+				entry[binary_theme::VALUE_TYPE] = binary_theme::INT;
+				entry[binary_theme::VALUE] = static_cast<std::uint32_t>( int_value );
+			}
+			else if( parsed.Get( unsigned_int_value ) && ( sfg::priv::PropertyValue( unsigned_int_value ).GetString() == value ) ) {
+				entry[binary_theme::VALUE_TYPE] = binary_theme::UNSIGNED_INT;
+				entry[binary_theme::VALUE] = unsigned_int_value;
+			}
+			else if( parsed.Get( float_value ) && ( sfg::priv::PropertyValue( float_value ).GetString() == value ) ) {
+				entry[binary_theme::VALUE_TYPE] = binary_theme::FLOAT;
+				std::memcpy( &entry[binary_theme::VALUE], &float_value, 4 );
+			}
+			else {
+				entry[binary_theme::VALUE] = AddString( value );
+			}
+
+			m_rules.push_back( entry );
+		}
+
+		bool Write( std::vector<char>& compiled ) const {
+			// Lay out header, tables and string data.
+			auto size =
+				binary_theme::header_size +
+				m_strings.size() * binary_theme::string_size +
+				m_selectors.size() * binary_theme::selector_size +
+				m_rules.size() * binary_theme::rule_size;
+
+			std::vector<std::size_t> string_offsets;
+
+			for( const auto& string : m_strings ) {
+				string_offsets.push_back( size );
+				size += string.size();
+			}
+
+			if( size > std::numeric_limits<std::uint32_t>::max() ) {
+				return false;
+			}
+
+			compiled.assign( size, 0 );
+
+			std::copy( std::begin( binary_theme::magic ), std::end( binary_theme::magic ), compiled.begin() );
+			binary_theme::Write( &compiled[binary_theme::VERSION * 4], binary_theme::version );
+			binary_theme::Write( &compiled[binary_theme::STRING_COUNT * 4], static_cast<std::uint32_t>( m_strings.size() ) );
+			binary_theme::Write( &compiled[binary_theme::SELECTOR_COUNT * 4], static_cast<std::uint32_t>( m_selectors.size() ) );
+			binary_theme::Write( &compiled[binary_theme::RULE_COUNT * 4], static_cast<std::uint32_t>( m_rules.size() ) );
+
+			auto record = &compiled[binary_theme::header_size];
+
+			for( std::size_t index = 0; index < m_strings.size(); ++index ) {
+				binary_theme::Write( record + binary_theme::STRING_OFFSET * 4, static_cast<std::uint32_t>( string_offsets[index] ) );
+				binary_theme::Write( record + binary_theme::STRING_LENGTH * 4, static_cast<std::uint32_t>( m_strings[index].size() ) );
+
+				std::copy( m_strings[index].begin(), m_strings[index].end(), compiled.begin() + static_cast<std::ptrdiff_t>( string_offsets[index] ) );
+
+				record += binary_theme::string_size;
+			}
+
+			for( const auto& selector : m_selectors ) {
+				for( std::size_t field = 0; field < selector.size(); ++field ) {
+					binary_theme::Write( record + field * 4, selector[field] );
+				}
+
+				record += binary_theme::selector_size;
+			}
+
+			for( const auto& rule : m_rules ) {
+				for( std::size_t field = 0; field < rule.size(); ++field ) {
+					binary_theme::Write( record + field * 4, rule[field] );
+				}
+
+				record += binary_theme::rule_size;
+			}
+
+			return true;
+		}
+
+	private:
+		std::vector<std::string> m_strings;
+		std::unordered_map<std::string, std::uint32_t> m_string_indices;
+		std::vector<SelectorEntry> m_selectors;
+		std::map<SelectorEntry, std::uint32_t> m_selector_indices;
+		std::vector<RuleEntry> m_rules;
+};
+
+std::uint32_t ReadField( const char* table, std::size_t index, std::size_t entry_size, std::size_t field ) {
+	return binary_theme::Read( table + index * entry_size + field * 4 );
+}
+
+}
+
+namespace sfg {
+
+bool Engine::CompileTheme( const std::string& data, std::vector<char>& compiled ) {
+	auto theme = parser::theme::ParseString( data );
+
+	if( theme.empty() ) {
+		return false;
+	}
+
+	ThemeCompiler compiler;
+
+	// Same order as ParseTheme() adds the rules in.
+	for( const auto& rule : theme ) {
+		std::vector<std::uint32_t> selectors;
+		auto selector = binary_theme::no_parent;
+
+		for( const auto& simple_selector : rule.m_selector.m_simple_selectors ) {
+			auto hierarchy = Selector::HierarchyType::ROOT;
+
+			if( simple_selector.m_combinator == ">" ) {
+				hierarchy = Selector::HierarchyType::CHILD;
+			}
+			else if( simple_selector.m_combinator == " " ) {
+				hierarchy = Selector::HierarchyType::DESCENDANT;
+			}
+			else if( simple_selector.m_combinator == "," ) {
+				selectors.push_back( selector );
+				selector = binary_theme::no_parent;
+			}
+
+			selector = compiler.AddSelector( simple_selector, hierarchy, selector );
+		}
+
+		selectors.push_back( selector );
+
+		for( auto index : selectors ) {
+			if( index == binary_theme::no_parent ) {
+				continue;
+			}
+
+			for( const auto& declaration : rule.m_declarations ) {
+				compiler.AddRule( index, declaration.m_property_name, declaration.m_property_value );
+			}
+		}
+	}
+
+	return compiler.Write( compiled );
+}
+
+bool Engine::LoadCompiledTheme( const char* data, std::size_t size ) {
+	if( !binary_theme::IsBinaryTheme( data, size ) || ( binary_theme::Read( data + binary_theme::VERSION * 4 ) != binary_theme::version ) ) {
+		return false;
+	}
+
+	auto string_count = binary_theme::Read( data + binary_theme::STRING_COUNT * 4 );
+	auto selector_count = binary_theme::Read( data + binary_theme::SELECTOR_COUNT * 4 );
+	auto rule_count = binary_theme::Read( data + binary_theme::RULE_COUNT * 4 );
+
+	// Counts are 32 bit, the tables' size can't overflow 64 bits.
+	auto tables_size =
+		static_cast<std::uint64_t>( binary_theme::header_size ) +
+		static_cast<std::uint64_t>( string_count ) * binary_theme::string_size +
+		static_cast<std::uint64_t>( selector_count ) * binary_theme::selector_size +
+		static_cast<std::uint64_t>( rule_count ) * binary_theme::rule_size;
+
+	if( tables_size > size ) {
+		return false;
+	}
+
+	auto string_table = data + binary_theme::header_size;
+	auto selector_table = string_table + string_count * binary_theme::string_size;
+	auto rule_table = selector_table + selector_count * binary_theme::selector_size;
+
+	std::vector<std::string> strings;
+	strings.reserve( string_count );
+
+	for( std::size_t index = 0; index < string_count; ++index ) {
+		auto offset = ReadField( string_table, index, binary_theme::string_size, binary_theme::STRING_OFFSET );
+		auto length = ReadField( string_table, index, binary_theme::string_size, binary_theme::STRING_LENGTH );
+
+		if( static_cast<std::uint64_t>( offset ) + length > size ) {
+			return false;
+		}
+
+		strings.emplace_back( data + offset, length );
+	}
+
+	std::vector<Selector::Ptr> selectors;
+	selectors.reserve( selector_count );
+
+	for( std::size_t index = 0; index < selector_count; ++index ) {
+		SelectorEntry entry;
+
+		for( std::size_t field = 0; field < entry.size(); ++field ) {
+			entry[field] = ReadField( selector_table, index, binary_theme::selector_size, field );
+		}
+
+		if(
+			( entry[binary_theme::WIDGET] >= string_count ) ||
+			( entry[binary_theme::ID] >= string_count ) ||
+			( entry[binary_theme::CLASS] >= string_count ) ||
+			( entry[binary_theme::STATE] >= string_count ) ||
+			( entry[binary_theme::HIERARCHY] < static_cast<std::uint32_t>( Selector::HierarchyType::ROOT ) ) ||
+			( entry[binary_theme::HIERARCHY] > static_cast<std::uint32_t>( Selector::HierarchyType::DESCENDANT ) ) ||
+			( ( entry[binary_theme::PARENT] != binary_theme::no_parent ) && ( entry[binary_theme::PARENT] >= index ) )
+		) {
+			return false;
+		}
+
+		selectors.push_back( Selector::Create(
+			strings[entry[binary_theme::WIDGET]],
+			strings[entry[binary_theme::ID]],
+			strings[entry[binary_theme::CLASS]],
+			strings[entry[binary_theme::STATE]],
+			static_cast<Selector::HierarchyType>( entry[binary_theme::HIERARCHY] ),
+			( entry[binary_theme::PARENT] != binary_theme::no_parent ) ? selectors[entry[binary_theme::PARENT]] : Selector::Ptr()
+		) );
+	}
+
+	// Check all rules before adding any, a damaged theme shouldn't be installed halfway.
+	for( std::size_t index = 0; index < rule_count; ++index ) {
+		auto type = ReadField( rule_table, index, binary_theme::rule_size, binary_theme::VALUE_TYPE );
+
+		if(
+			( ReadField( rule_table, index, binary_theme::rule_size, binary_theme::SELECTOR ) >= selector_count ) ||
+			( ReadField( rule_table, index, binary_theme::rule_size, binary_theme::PROPERTY ) >= string_count ) ||
+			( type > binary_theme::UNSIGNED_INT ) ||
+			( ( type == binary_theme::STRING ) && ( ReadField( rule_table, index, binary_theme::rule_size, binary_theme::VALUE ) >= string_count ) )
+		) {
+			return false;
+		}
+	}
+
+	// Property names are interned once per string, not once per rule.
+	std::vector<Atom> properties( string_count );
+
+	StyleChangeList changes;
+
+	for( std::size_t index = 0; index < rule_count; ++index ) {
+		RuleEntry entry;
+
+		for( std::size_t field = 0; field < entry.size(); ++field ) {
+			entry[field] = ReadField( rule_table, index, binary_theme::rule_size, field );
+		}
+
+		auto& property = properties[entry[binary_theme::PROPERTY]];
+
+		if( property == Atom() ) {
+			property = Atom( strings[entry[binary_theme::PROPERTY]] );
+		}
+
+		auto value = entry[binary_theme::VALUE];
+		float float_value;
+
+		switch( entry[binary_theme::VALUE_TYPE] ) {
+			case binary_theme::COLOR:
+				AddRule( selectors[entry[binary_theme::SELECTOR]], property, priv::PropertyValue( sf::Color(
+					static_cast<sf::Uint8>( value & 0xff ),
+					static_cast<sf::Uint8>( ( value >> 8 ) & 0xff ),
+					static_cast<sf::Uint8>( ( value >> 16 ) & 0xff ),
+					static_cast<sf::Uint8>( ( value >> 24 ) & 0xff )
+				) ) );
+				break;
+			case binary_theme::FLOAT:
+				std::memcpy( &float_value, &value, 4 );
+				AddRule( selectors[entry[binary_theme::SELECTOR]], property, priv::PropertyValue( float_value ) );
+				break;
+			case binary_theme::INT:
+				AddRule( selectors[entry[binary_theme::SELECTOR]], property, priv::PropertyValue( static_cast<int>( value ) ) );
+				break;
+			case binary_theme::UNSIGNED_INT:
+				AddRule( selectors[entry[binary_theme::SELECTOR]], property, priv::PropertyValue( static_cast<unsigned int>( value ) ) );
+				break;
+			default:
+				AddRule( selectors[entry[binary_theme::SELECTOR]], property, priv::PropertyValue( strings[value] ) );
+				break;
+		}
+
+		AddStyleChange( changes, selectors[entry[binary_theme::SELECTOR]], property );
+	}
+
+	ApplyStyleChanges( changes );
+
+	return true;
+}
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <SFGUI/ResourceArchive.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+
+namespace sfg {
+namespace priv {
+
+/** Layout of compiled themes as written by Engine::CompileTheme().
+ *
+ * All numbers are 32 bit little endian. The file starts with a header:
+ *   magic "SFGT", version, string count, selector count, rule count, reserved
+ * It is followed by the string table:
+ *   offset, length
+ * the selector table, one entry per simple selector, parents first:
+ *   widget name, ID, class, state, hierarchy type, parent index
+ * and the rule table, in the order the rules have to be added:
+ *   selector index, property name, value type, value
+ * Names, IDs, classes, states and string values are indices into the string
+ * table. The string data is stored behind the tables, offsets are relative to
+ * the start of the file.
+ */
+namespace binary_theme {
+
+const char magic[4] = { 'S', 'F', 'G', 'T' };
+const std::uint32_t version = 1;
+
+const std::size_t header_size = 24;
+const std::size_t string_size = 8;
+const std::size_t selector_size = 24;
+const std::size_t rule_size = 16;
+
+const std::uint32_t no_parent = 0xffffffff;
+
+/** Header fields, in units of 32 bit numbers.
+ */
+enum HeaderField : std::size_t {
+	VERSION = 1,
+	STRING_COUNT,
+	SELECTOR_COUNT,
+	RULE_COUNT
+};
+
+/** String fields, in units of 32 bit numbers.
+ */
+enum StringField : std::size_t {
+	STRING_OFFSET = 0,
+	STRING_LENGTH
+};
+
+/** Selector fields, in units of 32 bit numbers.
+ */
+enum SelectorField : std::size_t {
+	WIDGET = 0,
+	ID,
+	CLASS,
+	STATE,
+	HIERARCHY,
+	PARENT
+};
+
+/** Rule fields, in units of 32 bit numbers.
+ */
+enum RuleField : std::size_t {
+	SELECTOR = 0,
+	PROPERTY,
+	VALUE_TYPE,
+	VALUE
+};
+
+/** Value types.
+ * Values are only stored typed if they are written exactly like the typed
+ * value would be formatted, everything else is kept as string.
+ */
+enum ValueType : std::uint32_t {
+	STRING = 0, //!< String table index.
+	COLOR = 1, //!< r | g << 8 | b << 16 | a << 24.
+	FLOAT = 2, //!< IEEE 754 single precision bits.
+	INT = 3, //!< Two's complement.
+	UNSIGNED_INT = 4
+};
+
+using archive::Read;
+using archive::Write;
+
+/** Check whether data starts like a compiled theme.
+ * @param data Data.
+ * @param size Size of data.
+ * @return true if the magic matches.
+ */
+inline bool IsBinaryTheme( const char* data, std::size_t size ) {
+	return ( size >= header_size ) && std::equal( std::begin( magic ), std::end( magic ), data );
+}
+
+}
+
+}
+}
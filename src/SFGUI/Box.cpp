@@ -3,12 +3,36 @@
 #include <SFGUI/Engine.hpp>
 
 #include <iterator>
+#include <limits>
+
+namespace {
+
+const auto no_child = std::numeric_limits<std::size_t>::max();
+
+// Number of incremental total updates after which the totals are summed
+// up from scratch again, so rounding errors can't pile up forever.
+const unsigned int max_total_updates = 1024;
+
+}
 
 namespace sfg {
 
 Box::Box( Orientation orientation, float spacing ) :
 	m_spacing( spacing ),
-	m_orientation( orientation )
+	m_orientation( orientation ),
+	m_children_length( 0. ),
+	m_num_visible( 0 ),
+	m_num_expand( 0 ),
+	m_num_broadest_children( 0 ),
+	m_num_total_updates( 0 ),
+	m_first_invalid_child( no_child ),
+	m_last_invalid_child( 0 ),
+	m_allocated_extra( 0.f ),
+	m_allocated_breadth( 0.f ),
+	m_allocated_gap( 0.f ),
+	m_totals_invalid( true ),
+	m_allocation_invalid( true ),
+	m_child_indices_invalid( true )
 {
 }
 
@@ -29,6 +53,15 @@ void Box::PackEnd( Widget::Ptr widget, bool expand, bool fill ) {
 	// It's important to create the ChildInfo object first, so that the
 	// HandleAdd() method recognized the widget as a correctly packed one.
 	m_box_children.push_back( ChildInfo( widget, expand, fill ) );
+
+	// Appending doesn't move any other child, only the new one has to be
+	// accounted for.
+	if( !m_child_indices_invalid ) {
+		m_child_indices[widget.get()] = m_box_children.size() - 1;
+	}
+
+	InvalidateChild( m_box_children.size() - 1 );
+
 	Add( widget );
 }
 
@@ -40,6 +73,8 @@ void Box::PackStart( Widget::Ptr widget, bool expand, bool fill ) {
 	// It's important to create the ChildInfo object first, so that the
 	// HandleAdd() method recognized the widget as a correctly packed one.
 	m_box_children.push_front( ChildInfo( widget, expand, fill ) );
+	InvalidateLayout();
+
 	Add( widget );
 }
 
@@ -61,6 +96,7 @@ void Box::ReorderChild( Widget::Ptr widget, std::size_t position ) {
 	m_box_children.insert( insertion_point, *iter );
 	m_box_children.erase( iter );
 
+	InvalidateLayout();
 	Invalidate();
 	AllocateChildren();
 }
@@ -94,39 +130,22 @@ void Box::HandleRemove( Widget::Ptr child ) {
 		m_box_children.erase( iter );
 	}
 
+	InvalidateLayout();
 	RequestResize();
 	Invalidate();
 }
 
 sf::Vector2f Box::CalculateRequisition() {
-	sf::Vector2f requisition( 0.f, 0.f );
-	unsigned int num_visible( 0 );
-
-	for( const auto& child : m_box_children ) {
-		if( !IsChildInteresting( child.widget ) ) {
-			continue;
-		}
-
-		++num_visible;
-
-		sf::Vector2f child_requisition( child.widget->GetRequisition() );
+	UpdateTotals();
 
-		if( m_orientation == Orientation::HORIZONTAL ) {
-			requisition.x += child_requisition.x;
-			requisition.y = std::max( requisition.y, child_requisition.y );
-		}
-		else {
-			requisition.x = std::max( requisition.x, child_requisition.x );
-			requisition.y += child_requisition.y;
-		}
-	}
+	sf::Vector2f requisition( m_children_requisition );
 
-	if( num_visible > 1 ) {
+	if( m_num_visible > 1 ) {
 		if( m_orientation == Orientation::HORIZONTAL ) {
-			requisition.x += static_cast<float>( num_visible - 1 ) * GetSpacing();
+			requisition.x += static_cast<float>( m_num_visible - 1 ) * GetSpacing();
 		}
 		else {
-			requisition.y += static_cast<float>( num_visible - 1 ) * GetSpacing();
+			requisition.y += static_cast<float>( m_num_visible - 1 ) * GetSpacing();
 		}
 	}
 
@@ -144,7 +163,10 @@ void Box::HandleSizeChange() {
 Box::ChildInfo::ChildInfo( Widget::Ptr widget_, bool expand_, bool fill_ ) :
 	widget( widget_.get() ),
 	expand( expand_ ),
-	fill( fill_ )
+	fill( fill_ ),
+	interesting( false ),
+	requisition( 0.f, 0.f ),
+	position( 0.f )
 {
 }
 
@@ -154,12 +176,14 @@ bool Box::ChildInfo::operator==( const ChildInfo& rhs ) const {
 
 void Box::SetSpacing( float spacing ) {
 	m_spacing = spacing;
+	InvalidateLayout();
 	RequestResize();
 	Invalidate();
 }
 
 void Box::SetOrientation( Orientation orientation ) {
 	m_orientation = orientation;
+	InvalidateLayout();
 	RequestResize();
 	Invalidate();
 }
@@ -172,61 +196,86 @@ Box::Orientation Box::GetOrientation() const {
 	return m_orientation;
 }
 
-void Box::AllocateChildren() const {
-	unsigned int num_expand( 0 );
-	unsigned int num_visible( 0 );
-
-	// Count number of visible and expanded children.
-	for( const auto& child : m_box_children ) {
-		if( !IsChildInteresting( child.widget ) ) {
-			continue;
-		}
-
-		++num_visible;
-
-		if( child.expand ) {
-			++num_expand;
-		}
-	}
+void Box::AllocateChildren() {
+	UpdateTotals();
 
 	// Calculate extra width pre expanded widget.
 	float extra( 0.f );
 
-	if( num_expand > 0 ) {
+	if( m_num_expand > 0 ) {
 		if( m_orientation == Orientation::HORIZONTAL ) {
-			extra = std::max( 0.f, GetAllocation().width - GetRequisition().x ) / static_cast<float>( num_expand );
+			extra = std::max( 0.f, GetAllocation().width - GetRequisition().x ) / static_cast<float>( m_num_expand );
 		}
 		else {
-			extra = std::max( 0.f, GetAllocation().height - GetRequisition().y ) / static_cast<float>( num_expand );
+			extra = std::max( 0.f, GetAllocation().height - GetRequisition().y ) / static_cast<float>( m_num_expand );
 		}
 	}
 
-	// Allocate children.
 	float gap( Context::Get().GetEngine().GetProperty<float>( "Gap", shared_from_this() ) );
+	float breadth( ( m_orientation == Orientation::HORIZONTAL ? GetAllocation().height : GetAllocation().width ) - 2 * gap );
+
+	auto first_child = m_first_invalid_child;
+	auto last_child = m_last_invalid_child;
+
+	// If anything affecting all children changed, every child has to be
+	// reallocated. Otherwise only the changed children and the ones after them
+	// have to be moved.
+	if(
+		m_allocation_invalid ||
+		( extra != m_allocated_extra ) ||
+		( breadth != m_allocated_breadth ) ||
+		( gap != m_allocated_gap )
+	) {
+		first_child = 0;
+		last_child = m_box_children.size();
+	}
+
+	// Reset the state before allocating, children might request a resize
+	// while being allocated.
+	m_first_invalid_child = no_child;
+	m_last_invalid_child = 0;
+	m_allocation_invalid = false;
+	m_allocated_extra = extra;
+	m_allocated_breadth = breadth;
+	m_allocated_gap = gap;
+
+	if( first_child >= m_box_children.size() ) {
+		return;
+	}
+
+	// Allocate children.
 	sf::Vector2f allocation( 0.f, 0.f );
-	sf::Vector2f position( gap, gap );
+	float position( first_child == 0 ? gap : m_box_children[first_child].position );
+
+	for( auto child_index = first_child; child_index < m_box_children.size(); ++child_index ) {
+		auto& child = m_box_children[child_index];
 
-	for( const auto& child : m_box_children ) {
-		if( !IsChildInteresting( child.widget ) ) {
+		// Children after the last changed child only have to be moved if the
+		// position they start at changed.
+		if( ( child_index > last_child ) && ( child.position == position ) ) {
+			break;
+		}
+
+		child.position = position;
+
+		if( !child.interesting ) {
 			continue;
 		}
 
 		if( m_orientation == Orientation::HORIZONTAL ) {
 			allocation.x = child.widget->GetRequisition().x + ( child.expand ? extra : 0.f );
-			allocation.y = GetAllocation().height - 2 * gap;
+			allocation.y = breadth;
 
-			child.widget->SetAllocation( sf::FloatRect( position.x, position.y, allocation.x - ( child.expand && !child.fill ? extra : 0.f ), allocation.y ) );
-			position.x += allocation.x + GetSpacing();
+			child.widget->SetAllocation( sf::FloatRect( position, gap, allocation.x - ( child.expand && !child.fill ? extra : 0.f ), allocation.y ) );
+			position += allocation.x + GetSpacing();
 		}
 		else {
-			allocation.x = GetAllocation().width - 2 * gap;
+			allocation.x = breadth;
 			allocation.y = child.widget->GetRequisition().y + ( child.expand ? extra : 0.f );
 
-			child.widget->SetAllocation( sf::FloatRect( position.x, position.y, allocation.x, allocation.y - ( child.expand && !child.fill ? extra : 0.f ) ) );
-			position.y += allocation.y + GetSpacing();
+			child.widget->SetAllocation( sf::FloatRect( gap, position, allocation.x, allocation.y - ( child.expand && !child.fill ? extra : 0.f ) ) );
+			position += allocation.y + GetSpacing();
 		}
-
-		--num_visible;
 	}
 }
 
@@ -242,4 +291,133 @@ void Box::HandleRequisitionChange() {
 	AllocateChildren();
 }
 
+void Box::HandleChildRequisitionChange( Widget::PtrConst child ) {
+	if( m_child_indices_invalid ) {
+		m_child_indices.clear();
+
+		for( std::size_t child_index = 0; child_index < m_box_children.size(); ++child_index ) {
+			m_child_indices[m_box_children[child_index].widget] = child_index;
+		}
+
+		m_child_indices_invalid = false;
+	}
+
+	auto iter = m_child_indices.find( child.get() );
+
+	if( iter == m_child_indices.end() ) {
+		return;
+	}
+
+	InvalidateChild( iter->second );
+}
+
+void Box::UpdateTotals() {
+	if( !m_totals_invalid ) {
+		return;
+	}
+
+	m_children_requisition = sf::Vector2f( 0.f, 0.f );
+	m_children_length = 0.;
+	m_num_visible = 0;
+	m_num_expand = 0;
+	m_num_broadest_children = 0;
+	m_num_total_updates = 0;
+	m_totals_invalid = false;
+
+	for( auto& child : m_box_children ) {
+		child.interesting = IsChildInteresting( child.widget );
+		child.requisition = child.widget->GetRequisition();
+
+		AddToTotals( child );
+	}
+}
+
+void Box::AddToTotals( const ChildInfo& child ) {
+	if( m_totals_invalid || !child.interesting ) {
+		return;
+	}
+
+	++m_num_visible;
+
+	if( child.expand ) {
+		++m_num_expand;
+	}
+
+	auto length = ( m_orientation == Orientation::HORIZONTAL ? child.requisition.x : child.requisition.y );
+	auto breadth = ( m_orientation == Orientation::HORIZONTAL ? child.requisition.y : child.requisition.x );
+
+	auto& total_length = ( m_orientation == Orientation::HORIZONTAL ? m_children_requisition.x : m_children_requisition.y );
+	auto& total_breadth = ( m_orientation == Orientation::HORIZONTAL ? m_children_requisition.y : m_children_requisition.x );
+
+	m_children_length += length;
+	total_length = static_cast<float>( m_children_length );
+
+	// Breadths are never summed up, total_breadth is an exact copy of
+	// the broadest child's breadth so comparing them for equality is fine.
+	if( breadth > total_breadth ) {
+		total_breadth = breadth;
+		m_num_broadest_children = 1;
+	}
+	else if( breadth == total_breadth ) {
+		++m_num_broadest_children;
+	}
+}
+
+void Box::RemoveFromTotals( const ChildInfo& child ) {
+	if( m_totals_invalid || !child.interesting ) {
+		return;
+	}
+
+	--m_num_visible;
+
+	if( child.expand ) {
+		--m_num_expand;
+	}
+
+	auto length = ( m_orientation == Orientation::HORIZONTAL ? child.requisition.x : child.requisition.y );
+	auto breadth = ( m_orientation == Orientation::HORIZONTAL ? child.requisition.y : child.requisition.x );
+
+	auto& total_length = ( m_orientation == Orientation::HORIZONTAL ? m_children_requisition.x : m_children_requisition.y );
+	auto& total_breadth = ( m_orientation == Orientation::HORIZONTAL ? m_children_requisition.y : m_children_requisition.x );
+
+	m_children_length -= length;
+	total_length = static_cast<float>( m_children_length );
+
+	// If the last of the broadest children is removed, the next broadest one
+	// can only be found by looking at all children again.
+	if( ( breadth >= total_breadth ) && ( --m_num_broadest_children == 0 ) ) {
+		m_totals_invalid = true;
+	}
+}
+
+void Box::InvalidateChild( std::size_t index ) {
+	auto& child = m_box_children[index];
+
+	if( ++m_num_total_updates >= max_total_updates ) {
+		m_totals_invalid = true;
+	}
+
+	RemoveFromTotals( child );
+
+	child.interesting = IsChildInteresting( child.widget );
+	child.requisition = child.widget->GetRequisition();
+
+	AddToTotals( child );
+
+	if( m_first_invalid_child == no_child ) {
+		m_first_invalid_child = index;
+		m_last_invalid_child = index;
+	}
+	else {
+		m_first_invalid_child = std::min( m_first_invalid_child, index );
+		m_last_invalid_child = std::max( m_last_invalid_child, index );
+	}
+}
+
+void Box::InvalidateLayout() {
+	m_totals_invalid = true;
+	m_allocation_invalid = true;
+	m_child_indices_invalid = true;
+}
+
 }
@@ -0,0 +1,116 @@
+#include <SFGUI/CommandQueue.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace sfg {
+
+// Intrusive multi-producer single-consumer queue. Producers only swap the head
+// and link the previous head to the new node. The consumer walks the list from
+// the tail. The stub node keeps the list non-empty so producers and consumer
+// never have to touch the same pointer.
+
+CommandQueue::Node::Node() :
+	next( nullptr )
+{
+}
+
+CommandQueue::CommandQueue() :
+	m_head( &m_stub ),
+	m_tail( &m_stub )
+{
+}
+
+CommandQueue::~CommandQueue() {
+	while( auto node = Pop() ) {
+		delete node;
+	}
+}
+
+void CommandQueue::Push( Command command ) {
+	auto node = new Node;
+	node->command = std::move( command );
+
+	auto previous = m_head.exchange( node, std::memory_order_acq_rel );
+
+	// Between the exchange and this store the node is not reachable
+	// by the consumer yet, it just sees an empty queue until then.
+	previous->next.store( node, std::memory_order_release );
+}
+
+std::size_t CommandQueue::Execute( float budget ) {
+	auto start = std::chrono::steady_clock::now();
+	std::size_t executed = 0;
+
+	// Only execute what is queued right now. Commands pushed while
+	// executing, e.g. by a command that reposts itself, have to wait
+	// for the next call or this might never return. If the stub is the
+	// last node, everything in front of it was queued before and we are
+	// done once the stub is the next node to pop.
+	auto last = m_head.load( std::memory_order_acquire );
+
+	if( ( last == &m_stub ) && ( m_tail == &m_stub ) ) {
+		return executed;
+	}
+
+	while( auto node = Pop() ) {
+		// Make sure the node is freed even if the command throws.
+		std::unique_ptr<Node> node_guard( node );
+
+		node->command();
+		++executed;
+
+		if( ( node == last ) || ( ( last == &m_stub ) && ( m_tail == &m_stub ) ) ) {
+			break;
+		}
+
+		if( ( budget > 0.f ) && ( std::chrono::duration<float>( std::chrono::steady_clock::now() - start ).count() >= budget ) ) {
+			break;
+		}
+	}
+
+	return executed;
+}
+
+CommandQueue::Node* CommandQueue::Pop() {
+	auto tail = m_tail;
+	auto next = tail->next.load( std::memory_order_acquire );
+
+	if( tail == &m_stub ) {
+		if( !next ) {
+			return nullptr;
+		}
+
+		m_tail = next;
+		tail = next;
+		next = next->next.load( std::memory_order_acquire );
+	}
+
+	if( next ) {
+		m_tail = next;
+		return tail;
+	}
+
+	// tail is the last node we can see. If a producer is about to link
+	// a node after it we have to wait for that to become visible.
+	if( tail != m_head.load( std::memory_order_acquire ) ) {
+		return nullptr;
+	}
+
+	// Put the stub back behind tail so tail can be handed out.
+	m_stub.next.store( nullptr, std::memory_order_relaxed );
+
+	auto previous = m_head.exchange( &m_stub, std::memory_order_acq_rel );
+	previous->next.store( &m_stub, std::memory_order_release );
+
+	next = tail->next.load( std::memory_order_acquire );
+
+	if( next ) {
+		m_tail = next;
+		return tail;
+	}
+
+	return nullptr;
+}
+
+}
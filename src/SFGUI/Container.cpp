@@ -1,9 +1,25 @@
 #include <SFGUI/Container.hpp>
 
 #include <SFML/Window/Event.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Containers with fewer children are hit-tested by simply checking every child.
+const std::size_t hit_grid_threshold = 16;
+
+}
 
 namespace sfg {
 
+Container::Container() :
+	m_hit_grid_columns( 0 ),
+	m_hit_grid_rows( 0 ),
+	m_hit_grid_invalid( true )
+{
+}
+
 void Container::Add( Widget::Ptr widget ) {
 	if( HandleAdd( widget ) ) {
 		widget->SetParent( shared_from_this() );
@@ -15,7 +31,21 @@ void Container::Remove( Widget::Ptr widget ) {
 	WidgetsList::iterator iter( std::find( m_children.begin(), m_children.end(), widget ) );
 
 	if( iter != m_children.end() ) {
+		auto index = static_cast<std::size_t>( iter - m_children.begin() );
+
 		m_children.erase( iter );
+
+		// Indices behind the removed child shift down by one.
+		m_tracking_children.erase( std::remove( m_tracking_children.begin(), m_tracking_children.end(), index ), m_tracking_children.end() );
+
+		for( auto& tracking_index : m_tracking_children ) {
+			if( tracking_index > index ) {
+				--tracking_index;
+			}
+		}
+
+		m_hit_grid_invalid = true;
+
 		widget->SetParent( Widget::Ptr() );
 		HandleRemove( widget );
 
@@ -24,6 +54,9 @@ void Container::Remove( Widget::Ptr widget ) {
 }
 
 void Container::RemoveAll() {
+	m_tracking_children.clear();
+	m_hit_grid_invalid = true;
+
 	while( !m_children.empty() ) {
 		auto widget = m_children.back();
 
@@ -74,21 +107,228 @@ void Container::HandleEvent( const sf::Event& event ) {
 		local_event.mouseButton.y -= static_cast<int>( GetAllocation().top );
 	}
 
-	// Pass event to children.
-	for( const auto& child : m_children ) {
-		child->HandleEvent( local_event );
+	if(
+		local_event.type == sf::Event::MouseMoved ||
+		local_event.type == sf::Event::MouseButtonPressed ||
+		local_event.type == sf::Event::MouseButtonReleased ||
+		local_event.type == sf::Event::MouseLeft
+	) {
+		// Only pass mouse events to children that are hit or still
+		// have to notice the mouse leaving or a button being released.
+		std::vector<std::size_t> receivers;
+		CollectMouseReceivers( local_event, receivers );
+
+		WidgetsList receiving_children;
+		receiving_children.reserve( receivers.size() );
+
+		for( auto index : receivers ) {
+			receiving_children.push_back( m_children[index] );
+		}
+
+		for( const auto& child : receiving_children ) {
+			child->HandleEvent( local_event );
+		}
+
+		// Remember who has to be notified next time. Handlers might
+		// have removed children, so look the indices up again.
+		m_tracking_children.clear();
+
+		for( const auto& child : receiving_children ) {
+			if( !IsTrackingMouse( child ) ) {
+				continue;
+			}
+
+			auto iter = std::find( m_children.begin(), m_children.end(), child );
+
+			if( iter != m_children.end() ) {
+				m_tracking_children.push_back( static_cast<std::size_t>( iter - m_children.begin() ) );
+			}
+		}
+	}
+	else if(
+		local_event.type == sf::Event::KeyPressed ||
+		local_event.type == sf::Event::KeyReleased ||
+		local_event.type == sf::Event::TextEntered
+	) {
+		// Only the focused widget processes keyboard and text events,
+		// so hand them to it directly instead of visiting every child.
+		auto focus_widget = GetFocusWidget();
+
+		if( GetChildOnPath( focus_widget ) ) {
+			focus_widget->HandleEvent( local_event );
+		}
+	}
+	else {
+		// Pass event to children.
+		for( const auto& child : m_children ) {
+			child->HandleEvent( local_event );
+		}
 	}
 
 	// Process event for own widget.
 	Widget::HandleEvent( event );
 }
 
+void Container::InvalidateHitGrid() {
+	m_hit_grid_invalid = true;
+}
+
+void Container::UpdateHitGrid() {
+	m_hit_grid_invalid = false;
+	m_hit_grid.clear();
+
+	if( m_children.size() < hit_grid_threshold ) {
+		return;
+	}
+
+	// Find the area covered by children and their average size.
+	auto left = m_children.front()->GetAllocation().left;
+	auto top = m_children.front()->GetAllocation().top;
+	auto right = left;
+	auto bottom = top;
+
+	sf::Vector2f average_size( 0.f, 0.f );
+
+	for( const auto& child : m_children ) {
+		const auto& allocation = child->GetAllocation();
+
+		left = std::min( left, allocation.left );
+		top = std::min( top, allocation.top );
+		right = std::max( right, allocation.left + allocation.width );
+		bottom = std::max( bottom, allocation.top + allocation.height );
+
+		average_size.x += allocation.width;
+		average_size.y += allocation.height;
+	}
+
+	average_size /= static_cast<float>( m_children.size() );
+
+	m_hit_grid_bounds = sf::FloatRect( left, top, right - left, bottom - top );
+
+	if( ( m_hit_grid_bounds.width <= 0.f ) || ( m_hit_grid_bounds.height <= 0.f ) ) {
+		return;
+	}
+
+	// Size cells like an average child, but keep the
+	// number of cells in the order of the number of children.
+	auto max_cells = static_cast<float>( m_children.size() );
+
+	auto columns = std::min( std::max( std::floor( m_hit_grid_bounds.width / std::max( average_size.x, 1.f ) ), 1.f ), max_cells );
+	auto rows = std::min( std::max( std::floor( m_hit_grid_bounds.height / std::max( average_size.y, 1.f ) ), 1.f ), std::max( std::floor( max_cells / columns ), 1.f ) );
+
+	m_hit_grid_columns = static_cast<std::size_t>( columns );
+	m_hit_grid_rows = static_cast<std::size_t>( rows );
+	m_hit_grid_cell_size = sf::Vector2f( m_hit_grid_bounds.width / columns, m_hit_grid_bounds.height / rows );
+
+	m_hit_grid.resize( m_hit_grid_columns * m_hit_grid_rows );
+
+	auto to_column = [&]( float x ) {
+		return std::min( static_cast<std::size_t>( std::max( ( x - m_hit_grid_bounds.left ) / m_hit_grid_cell_size.x, 0.f ) ), m_hit_grid_columns - 1 );
+	};
+
+	auto to_row = [&]( float y ) {
+		return std::min( static_cast<std::size_t>( std::max( ( y - m_hit_grid_bounds.top ) / m_hit_grid_cell_size.y, 0.f ) ), m_hit_grid_rows - 1 );
+	};
+
+	// Children are inserted in order, so every cell stays sorted.
+	for( std::size_t index = 0; index < m_children.size(); ++index ) {
+		const auto& allocation = m_children[index]->GetAllocation();
+
+		auto first_column = to_column( allocation.left );
+		auto last_column = to_column( allocation.left + allocation.width );
+		auto first_row = to_row( allocation.top );
+		auto last_row = to_row( allocation.top + allocation.height );
+
+		for( auto row = first_row; row <= last_row; ++row ) {
+			for( auto column = first_column; column <= last_column; ++column ) {
+				m_hit_grid[row * m_hit_grid_columns + column].push_back( index );
+			}
+		}
+	}
+}
+
+void Container::CollectMouseReceivers( const sf::Event& event, std::vector<std::size_t>& receivers ) {
+	receivers = m_tracking_children;
+
+	// Widgets holding the active or modal state may need events
+	// anywhere, e.g. while dragging or showing a popup.
+	AddPathReceiver( GetActiveWidget(), receivers );
+	AddPathReceiver( GetModalWidget(), receivers );
+
+	if( event.type != sf::Event::MouseLeft ) {
+		sf::Vector2f position;
+
+		if( event.type == sf::Event::MouseMoved ) {
+			position = sf::Vector2f( static_cast<float>( event.mouseMove.x ), static_cast<float>( event.mouseMove.y ) );
+		}
+		else {
+			position = sf::Vector2f( static_cast<float>( event.mouseButton.x ), static_cast<float>( event.mouseButton.y ) );
+		}
+
+		if( m_hit_grid_invalid ) {
+			UpdateHitGrid();
+		}
+
+		if( m_hit_grid.empty() ) {
+			for( std::size_t index = 0; index < m_children.size(); ++index ) {
+				if( m_children[index]->GetAllocation().contains( position ) ) {
+					receivers.push_back( index );
+				}
+			}
+		}
+		else if( m_hit_grid_bounds.contains( position ) ) {
+			auto column = std::min( static_cast<std::size_t>( ( position.x - m_hit_grid_bounds.left ) / m_hit_grid_cell_size.x ), m_hit_grid_columns - 1 );
+			auto row = std::min( static_cast<std::size_t>( ( position.y - m_hit_grid_bounds.top ) / m_hit_grid_cell_size.y ), m_hit_grid_rows - 1 );
+
+			for( auto index : m_hit_grid[row * m_hit_grid_columns + column] ) {
+				if( m_children[index]->GetAllocation().contains( position ) ) {
+					receivers.push_back( index );
+				}
+			}
+		}
+	}
+
+	// Keep the order children would have received the event in before.
+	std::sort( receivers.begin(), receivers.end() );
+	receivers.erase( std::unique( receivers.begin(), receivers.end() ), receivers.end() );
+}
+
+void Container::AddPathReceiver( Widget::Ptr widget, std::vector<std::size_t>& receivers ) const {
+	auto child = GetChildOnPath( widget );
+
+	if( !child ) {
+		return;
+	}
+
+	auto iter = std::find( m_children.begin(), m_children.end(), child );
+
+	if( iter != m_children.end() ) {
+		receivers.push_back( static_cast<std::size_t>( iter - m_children.begin() ) );
+	}
+}
+
+Widget::Ptr Container::GetChildOnPath( Widget::Ptr widget ) const {
+	// Find the child of ours that widget is or is contained in.
+	while( widget ) {
+		auto parent = widget->GetParent();
+
+		if( parent.get() == this ) {
+			return widget;
+		}
+
+		widget = parent;
+	}
+
+	return Widget::Ptr();
+}
+
 bool Container::HandleAdd( Widget::Ptr child ) {
 	if( IsChild( child ) ) {
 		return false;
 	}
 
 	m_children.push_back( child );
+	m_hit_grid_invalid = true;
 
 	child->SetViewport( GetViewport() );
 
@@ -106,6 +346,9 @@ void Container::HandleChildInvalidate( Widget::PtrConst child ) const {
 	}
 }
 
+void Container::HandleChildRequisitionChange( Widget::PtrConst /*child*/ ) {
+}
+
 void Container::HandleAbsolutePositionChange() {
 	// Update children's drawable positions.
 	for( const auto& child : m_children ) {
@@ -124,6 +367,15 @@ void Container::HandleGlobalVisibilityChange() {
 	}
 }
 
+void Container::HandleStyleChange() {
+	Widget::HandleStyleChange();
+
+	// Selectors can match against parents, so children are affected as well.
+	for( const auto& child : m_children ) {
+		child->HandleStyleChange();
+	}
+}
+
 void Container::HandleUpdate( float seconds ) {
 	Widget::HandleUpdate( seconds );
 
@@ -1,14 +1,93 @@
 #include <SFGUI/Desktop.hpp>
 #include <SFGUI/Widget.hpp>
+#include <SFGUI/Engine.hpp>
 
 #include <SFML/Window/Event.hpp>
+#include <algorithm>
 #include <limits>
 #include <iterator>
 
+namespace {
+
+// Level distance between neighbouring top level widgets. Leaves room
+// for the levels of their children.
+const int level_step = 65536;
+
+bool IsCoalescable( const sf::Event& event ) {
+	return
+		event.type == sf::Event::MouseMoved ||
+		event.type == sf::Event::MouseWheelMoved ||
+		event.type == sf::Event::MouseWheelScrolled;
+}
+
+// Merge event into pending if both are of the same kind.
+bool Coalesce( sf::Event& pending, const sf::Event& event ) {
+	if( pending.type != event.type ) {
+		return false;
+	}
+
+	switch( event.type ) {
+		case sf::Event::MouseMoved:
+			pending.mouseMove = event.mouseMove;
+			return true;
+		case sf::Event::MouseWheelMoved:
+			pending.mouseWheel.delta += event.mouseWheel.delta;
+			pending.mouseWheel.x = event.mouseWheel.x;
+			pending.mouseWheel.y = event.mouseWheel.y;
+			return true;
+		case sf::Event::MouseWheelScrolled:
+			if( pending.mouseWheelScroll.wheel != event.mouseWheelScroll.wheel ) {
+				return false;
+			}
+
+			pending.mouseWheelScroll.delta += event.mouseWheelScroll.delta;
+			pending.mouseWheelScroll.x = event.mouseWheelScroll.x;
+			pending.mouseWheelScroll.y = event.mouseWheelScroll.y;
+			return true;
+		default:
+			return false;
+	}
+}
+
+// Keeps a context active for the lifetime of the guard, even if a
+// command or signal handler throws. Leaves an already active context alone.
+class ContextGuard {
+	public:
+		explicit ContextGuard( sfg::Context& context ) :
+			m_activated( sfg::Context::Activate( context ) )
+		{
+		}
+
+		~ContextGuard() {
+			if( m_activated ) {
+				sfg::Context::Deactivate();
+			}
+		}
+
+		ContextGuard( const ContextGuard& ) = delete;
+		ContextGuard& operator=( const ContextGuard& ) = delete;
+
+	private:
+		bool m_activated;
+};
+
+}
+
 namespace sfg {
 
+Desktop::Desktop() :
+	m_command_queue( new CommandQueue ),
+	m_command_time_budget( 0.f )
+{
+}
+
 void Desktop::Update( float seconds ) {
-	Context::Activate( m_context );
+	ContextGuard context_guard( m_context );
+
+	m_command_queue->Execute( m_command_time_budget );
+
+	// Hand out resources that finished loading in the background.
+	m_context.GetEngine().GetResourceManager().Update();
 
 	std::reverse_iterator<WidgetsList::iterator> iter( std::end( m_children ) );
 	std::reverse_iterator<WidgetsList::iterator> finish( std::begin( m_children ) );
@@ -16,13 +95,23 @@ void Desktop::Update( float seconds ) {
 	for( ; iter != finish; ++iter ) {
 		(*iter)->Update( seconds );
 	}
+}
+
+void Desktop::Post( CommandQueue::Command command ) {
+	m_command_queue->Push( std::move( command ) );
+}
+
+void Desktop::SetCommandTimeBudget( float budget ) {
+	m_command_time_budget = budget;
+}
 
-	Context::Deactivate();
+float Desktop::GetCommandTimeBudget() const {
+	return m_command_time_budget;
 }
 
 void Desktop::HandleEvent( const sf::Event& event ) {
-	// Activate context.
-	Context::Activate( m_context );
+	// Activate context, restored when leaving.
+	ContextGuard context_guard( m_context );
 
 	sf::Vector2f position;
 	bool check_inside( false );
@@ -63,7 +152,7 @@ void Desktop::HandleEvent( const sf::Event& event ) {
 			m_children.erase( m_children.begin() + index );
 			m_children.push_front( widget );
 
-			RecalculateWidgetLevels();
+			RaiseWidgetLevel( widget );
 		}
 
 		// If inside check is needed, do so for all widgets except the top window.
@@ -92,9 +181,36 @@ void Desktop::HandleEvent( const sf::Event& event ) {
 			break;
 		}
 	}
+}
+
+void Desktop::HandleEvents( const std::vector<sf::Event>& events ) {
+	// Only runs of mouse move or wheel events are merged, events of another
+	// kind must not be reordered or see a different mouse position.
+	sf::Event pending;
+	auto has_pending = false;
+
+	for( const auto& event : events ) {
+		if( has_pending && Coalesce( pending, event ) ) {
+			continue;
+		}
+
+		if( has_pending ) {
+			HandleEvent( pending );
+			has_pending = false;
+		}
 
-	// Restore previous context.
-	Context::Deactivate();
+		if( IsCoalescable( event ) ) {
+			pending = event;
+			has_pending = true;
+		}
+		else {
+			HandleEvent( event );
+		}
+	}
+
+	if( has_pending ) {
+		HandleEvent( pending );
+	}
 }
 
 void Desktop::Add( std::shared_ptr<Widget> widget ) {
@@ -112,19 +228,16 @@ void Desktop::Add( std::shared_ptr<Widget> widget ) {
 
 	m_children.push_front( widget );
 
-	RecalculateWidgetLevels();
+	RaiseWidgetLevel( widget );
 
 	if( widget->GetAllocation().contains( static_cast<float>( m_last_mouse_pos.x ), static_cast<float>( m_last_mouse_pos.y ) ) ) {
 		SendFakeMouseMoveEvent( widget, m_last_mouse_pos.x, m_last_mouse_pos.y );
 	}
 
-	// Activate context.
-	Context::Activate( m_context );
+	// Activate context, restored when leaving.
+	ContextGuard context_guard( m_context );
 
 	widget->Refresh();
-
-	// Restore previous context.
-	Context::Deactivate();
 }
 
 void Desktop::Remove( std::shared_ptr<Widget> widget ) {
@@ -138,7 +251,7 @@ void Desktop::Remove( std::shared_ptr<Widget> widget ) {
 		m_last_receiver.reset();
 	}
 
-	RecalculateWidgetLevels();
+	// The remaining widgets keep their relative order, no need to touch their levels.
 
 	if( !m_children.empty() &&  m_children.front()->GetAllocation().contains( static_cast<float>( m_last_mouse_pos.x ), static_cast<float>( m_last_mouse_pos.y ) ) ) {
 		SendFakeMouseMoveEvent( m_children.front(), m_last_mouse_pos.x, m_last_mouse_pos.y );
@@ -151,8 +264,8 @@ void Desktop::RemoveAll() {
 }
 
 void Desktop::Refresh() {
-	// Activate context.
-	Context::Activate( m_context );
+	// Activate context, restored when leaving.
+	ContextGuard context_guard( m_context );
 
 	RecalculateWidgetLevels();
 
@@ -162,9 +275,6 @@ void Desktop::Refresh() {
 	for( ; iter != finish; ++iter ) {
 		(*iter)->Refresh();
 	}
-
-	// Restore previous context.
-	Context::Deactivate();
 }
 
 bool Desktop::LoadThemeFromFile( const std::string& filename ) {
@@ -196,7 +306,7 @@ void Desktop::BringToFront( std::shared_ptr<const Widget> child ) {
 	m_children.erase( iter );
 	m_children.push_front( ptr );
 
-	RecalculateWidgetLevels();
+	RaiseWidgetLevel( ptr );
 
 	if( child->GetAllocation().contains( static_cast<float>( m_last_mouse_pos.x ), static_cast<float>( m_last_mouse_pos.y ) ) ) {
 		SendFakeMouseMoveEvent( ptr, m_last_mouse_pos.x, m_last_mouse_pos.y );
@@ -212,7 +322,11 @@ void Desktop::SendFakeMouseMoveEvent( std::shared_ptr<Widget> widget, int x, int
 }
 
 void Desktop::RecalculateWidgetLevels() {
-	auto children_size = m_children.size();
+	if( m_children.empty() ) {
+		return;
+	}
+
+	auto step = std::min( level_step, std::numeric_limits<int>::max() / static_cast<int>( m_children.size() ) );
 	auto current_level = 0;
 
 	std::reverse_iterator<WidgetsList::iterator> iter( std::end( m_children ) );
@@ -220,9 +334,27 @@ void Desktop::RecalculateWidgetLevels() {
 
 	for( ; iter != finish; ++iter ) {
 		(*iter)->SetHierarchyLevel( current_level );
-		(*iter)->Invalidate();
-		current_level += std::numeric_limits<int>::max() / static_cast<int>( children_size );
+		current_level += step;
+	}
+}
+
+void Desktop::RaiseWidgetLevel( std::shared_ptr<Widget> widget ) {
+	// Levels decrease from front to back, so a widget that was just moved to the
+	// front only needs a level above the previous front widget's. Everything
+	// else keeps its level unless we run out of levels.
+	if( m_children.size() < 2 ) {
+		widget->SetHierarchyLevel( 0 );
+		return;
 	}
+
+	auto front_level = m_children[1]->GetHierarchyLevel();
+
+	if( front_level > std::numeric_limits<int>::max() - 2 * level_step ) {
+		RecalculateWidgetLevels();
+		return;
+	}
+
+	widget->SetHierarchyLevel( front_level + level_step );
 }
 
 bool Desktop::SetProperties( const std::string& properties ) {
@@ -1,13 +1,19 @@
 #include <SFGUI/Engine.hpp>
 #include <SFGUI/Selector.hpp>
 #include <SFGUI/Widget.hpp>
+#include <SFGUI/Container.hpp>
 #include <SFGUI/RenderQueue.hpp>
+#include <SFGUI/ResolvedStyle.hpp>
+#include <SFGUI/MappedFile.hpp>
+#include <SFGUI/BinaryTheme.hpp>
 #include <SFGUI/Parsers/ThemeParser/Parse.hpp>
 
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Color.hpp>
-#include <fstream>
 #include <algorithm>
+#include <limits>
+#include <utility>
+#include <cstring>
 #include <cstdlib>
 
 namespace sf {
@@ -50,9 +56,59 @@ std::istream& operator>>( std::istream& stream, Color& color ) {
 }
 
 
+namespace {
+
+// Marks values in resolved styles that haven't been looked up yet.
+const sfg::priv::PropertyValue unresolved_value( "" );
+
+const sfg::Atom wildcard( "*" );
+
+// Resolved styles don't look for expired children before they have this many.
+const std::size_t min_children_limit = 16;
+
+// Number of selector strings SetProperty() keeps parsed.
+const std::size_t max_cached_selectors = 1024;
+
+const auto no_property = std::numeric_limits<std::size_t>::max();
+
+// Properties that are only used for drawing or read whenever they are
+// needed. Changing any other property, including those SFGUI doesn't
+// know of, might change the requisition of widgets.
+const char* const paint_properties[] = {
+	"ArrowColor", "BackgroundColor", "BackgroundColorDark", "BackgroundColorPrelight",
+	"BarBorderColor", "BarBorderColorShift", "BarBorderWidth", "BarColor",
+	"BorderColor", "BorderColorShift", "CheckColor", "CheckSize", "CloseThickness",
+	"Color", "CycleDuration", "HighlightedColor", "InnerRadius", "RodThickness",
+	"ScrollButtonPrelightColor", "ScrollSpeed", "ShadowAlpha", "ShadowDistance",
+	"SliderColor", "StepperArrowColor", "StepperBackgroundColor", "StepperRepeatDelay",
+	"StepperSpeed", "Steps", "StoppedAlpha", "Thickness", "TitleBackgroundColor",
+	"TroughColor", "TroughWidth"
+};
+
+std::vector<sfg::Atom> CreatePaintPropertyAtoms() {
+	std::vector<sfg::Atom> atoms( std::begin( paint_properties ), std::end( paint_properties ) );
+	std::sort( atoms.begin(), atoms.end() );
+	return atoms;
+}
+
+bool AffectsLayout( const sfg::Atom& property ) {
+	// Sorted by atom ID, not alphabetically.
+	static const std::vector<sfg::Atom> paint_property_atoms( CreatePaintPropertyAtoms() );
+
+	return !std::binary_search( paint_property_atoms.begin(), paint_property_atoms.end(), property );
+}
+
+// Shared by all engines so a widget's resolved style
+// can't be mistaken as belonging to another engine.
+unsigned int last_style_generation = 0;
+
+}
+
 namespace sfg {
 
 Engine::Engine() :
+	m_style_generation( ++last_style_generation ),
+	m_rule_serial( 0 ),
 	m_auto_refresh( false )
 {
 }
@@ -226,19 +282,30 @@ bool Engine::LoadThemeFromString( const std::string& data ) {
 	return true;
 }
 
-bool Engine::LoadThemeFromFile( const std::string& filename ) {
-	std::ifstream in( filename.c_str() );
+bool Engine::LoadThemeFromMemory( const char* data, std::size_t size ) {
+	if( priv::binary_theme::IsBinaryTheme( data, size ) ) {
+		return LoadCompiledTheme( data, size );
+	}
+
+	auto theme = parser::theme::ParseString( data, size );
 
-	if( !in.good() ) {
+	if( theme.empty() ) {
 		return false;
 	}
 
-	std::string data(
-		(std::istreambuf_iterator<char>( in )),
-		(std::istreambuf_iterator<char>())
-	);
+	ParseTheme( theme );
 
-	return LoadThemeFromString( data );
+	return true;
+}
+
+bool Engine::LoadThemeFromFile( const std::string& filename ) {
+	priv::MappedFile file( filename );
+
+	if( !file.IsOpen() ) {
+		return false;
+	}
+
+	return LoadThemeFromMemory( file.GetData(), file.GetSize() );
 }
 
 void Engine::ShiftBorderColors( sf::Color& light_color, sf::Color& dark_color, int offset ) const {
@@ -252,55 +319,212 @@ void Engine::ShiftBorderColors( sf::Color& light_color, sf::Color& dark_color, i
 	dark_color.b = static_cast<sf::Uint8>( std::min( 255, std::max( 0, static_cast<int>( dark_color.b ) - offset ) ) );
 }
 
-const std::string* Engine::GetValue( const std::string& property, Widget::PtrConst widget ) const {
+const priv::PropertyValue* Engine::GetValue( const Atom& property, Widget::PtrConst widget ) const {
+	// Selectors never match without a widget.
+	if( !widget ) {
+		return nullptr;
+	}
+
 	// Look for property.
-	PropertyMap::const_iterator prop_iter( m_properties.find( property ) );
+	auto id = property.GetId();
+
+	if( ( id >= m_property_indices.size() ) || ( m_property_indices[id] == no_property ) ) {
+		return nullptr;
+	}
+
+	auto index = m_property_indices[id];
+
+	// Matching selectors is expensive, so remember the
+	// outcome until something affecting it changes.
+	auto& style = GetResolvedStyle( *widget );
+	auto& value = style.values[index];
+
+	if( value == &unresolved_value ) {
+		value = FindValue( m_properties[index], widget, style.ancestors );
+	}
+
+	return value;
+}
 
-	const std::string* value = 0;
-	int score = -1;
+const priv::PropertyValue* Engine::FindValue( const Property& property, Widget::PtrConst widget, const priv::AncestorFilter& ancestors ) const {
+	const Rule* best = nullptr;
+
+	auto match = [&]( const RuleList& rules ) {
+		for( const auto& rule : rules ) {
+			// Skip rules that couldn't beat the current best one anyway.
+			if( best && (
+				( rule.score < best->score ) || ( ( rule.score == best->score ) && (
+					( rule.typed < best->typed ) || ( ( rule.typed == best->typed ) && ( rule.serial < best->serial ) )
+				) )
+			) ) {
+				continue;
+			}
+
+			if( !ancestors.MightContain( rule.ancestors ) ) {
+				continue;
+			}
 
-	if( prop_iter != m_properties.end() ) {
-		WidgetNameMap::const_iterator name_iter;
+			if( rule.selector->Matches( widget ) ) {
+				best = &rule;
+			}
+		}
+	};
 
-		if( widget ) {
-			// Find widget-specific properties, first.
-			name_iter = prop_iter->second.find( widget->GetName() );
+	const auto& widget_id = widget->GetId();
 
-			if( name_iter != prop_iter->second.end() ) {
-				// Check against selectors.
-				for( const auto& selector_value : name_iter->second ) {
-					if( selector_value.first->Matches( widget ) ) {
-						// Found, check if it is better than current best.
-						auto new_score = selector_value.first->GetScore();
+	if( !widget_id.empty() ) {
+		auto iter = property.id_rules.find( widget_id );
+
+		if( iter != property.id_rules.end() ) {
+			match( iter->second );
+		}
+	}
+
+	const auto& widget_class = widget->GetClass();
+
+	if( !widget_class.empty() ) {
+		auto iter = property.class_rules.find( widget_class );
+
+		if( iter != property.class_rules.end() ) {
+			match( iter->second );
+		}
+	}
+
+	for( const auto& name_rules : property.name_rules ) {
+		if( name_rules.first == widget->GetNameAtom() ) {
+			match( name_rules.second );
+			break;
+		}
+	}
+
+	auto state = static_cast<std::size_t>( widget->GetState() );
+
+	if( state < property.state_rules.size() ) {
+		match( property.state_rules[state] );
+	}
 
-						if( new_score > score ) {
-							value = &selector_value.second;
-							score = new_score;
+	match( property.universal_rules );
+
+	return best ? &best->value : nullptr;
+}
+
+priv::ResolvedStyle& Engine::GetResolvedStyle( const Widget& widget ) const {
+	auto& style = widget.m_style;
+
+	// Styles are reset whenever the hierarchy or the
+	// names, IDs, classes and states within it change.
+	if( !style ) {
+		auto parent = widget.GetParent();
+
+		if( parent ) {
+			auto& parent_style = GetResolvedStyle( *parent );
+
+			auto& children = parent_style.children;
+
+			priv::ResolvedStyle::ChildKey key(
+				widget.GetNameAtom().GetId(),
+				widget.GetId(),
+				widget.GetClass(),
+				static_cast<int>( widget.GetState() )
+			);
+
+			auto child = children.find( key );
+
+			if( child != children.end() ) {
+				style = child->second.lock();
+			}
+
+			if( !style ) {
+				style = std::make_shared<priv::ResolvedStyle>();
+				style->generation = 0;
+				style->children_limit = min_children_limit;
+				style->ancestors = parent_style.ancestors;
+				style->ancestors.AddName( parent->GetNameAtom() );
+
+				const auto& id = parent->GetId();
+
+				if( !id.empty() ) {
+					style->ancestors.AddId( id );
+				}
+
+				const auto& class_ = parent->GetClass();
+
+				if( !class_.empty() ) {
+					style->ancestors.AddClass( class_ );
+				}
+
+				// Styles expire when the children change their ID, class or
+				// state. Remove them whenever the map doubled in size.
+				if( children.size() >= parent_style.children_limit ) {
+					for( auto iter = children.begin(); iter != children.end(); ) {
+						if( iter->second.expired() ) {
+							iter = children.erase( iter );
+						}
+						else {
+							++iter;
 						}
 					}
+
+					parent_style.children_limit = std::max( children.size() * 2, min_children_limit );
 				}
+
+				children[std::move( key )] = style;
 			}
 		}
+		else {
+			style = std::make_shared<priv::ResolvedStyle>();
+			style->generation = 0;
+			style->children_limit = min_children_limit;
+		}
+	}
 
-		// Look for general properties now.
-		name_iter = prop_iter->second.find( "*" );
+	if( style->generation != m_style_generation ) {
+		style->values.assign( m_properties.size(), &unresolved_value );
+		style->children.clear();
+		style->generation = m_style_generation;
+	}
 
-		if( name_iter != prop_iter->second.end() ) {
-			for( const auto& selector_value : name_iter->second ) {
-				if( selector_value.first->Matches( widget ) ) {
-					// Found, check if it is better than current best.
-					auto new_score = selector_value.first->GetScore();
+	return *style;
+}
 
-					if( new_score > score ) {
-						value = &selector_value.second;
-						score = new_score;
-					}
-				}
+Engine::RuleList& Engine::GetRuleList( Property& property, const Selector& selector ) {
+	if( !selector.GetId().empty() ) {
+		return property.id_rules[selector.GetId()];
+	}
+
+	if( !selector.GetClass().empty() ) {
+		return property.class_rules[selector.GetClass()];
+	}
+
+	const auto& name = selector.GetWidgetNameAtom();
+
+	if( ( name != Atom() ) && ( name != wildcard ) ) {
+		for( auto& name_rules : property.name_rules ) {
+			if( name_rules.first == name ) {
+				return name_rules.second;
 			}
 		}
+
+		property.name_rules.emplace_back( name, RuleList() );
+		return property.name_rules.back().second;
 	}
 
-	return value;
+	if( selector.GetState() ) {
+		auto state = static_cast<std::size_t>( *selector.GetState() );
+
+		if( state >= property.state_rules.size() ) {
+			property.state_rules.resize( state + 1 );
+		}
+
+		return property.state_rules[state];
+	}
+
+	return property.universal_rules;
+}
+
+void Engine::InvalidateResolvedStyles() {
+	// Resolved styles with another generation are discarded when used.
+	m_style_generation = ++last_style_generation;
 }
 
 ResourceManager& Engine::GetResourceManager() const {
@@ -316,6 +540,41 @@ void Engine::AddCharacterSet( sf::Uint32 low_bound, sf::Uint32 high_bound ) {
 }
 
 bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& property, const std::string& value ) {
+	return SetPropertyValue( selector, property, priv::PropertyValue( value ) );
+}
+
+bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& property, const sf::Color& value ) {
+	return SetPropertyValue( selector, property, priv::PropertyValue( value ) );
+}
+
+bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& property, float value ) {
+	return SetPropertyValue( selector, property, priv::PropertyValue( value ) );
+}
+
+bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& property, int value ) {
+	return SetPropertyValue( selector, property, priv::PropertyValue( value ) );
+}
+
+bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& property, unsigned int value ) {
+	return SetPropertyValue( selector, property, priv::PropertyValue( value ) );
+}
+
+bool Engine::SetPropertyValue( sfg::Selector::Ptr selector, const std::string& property, priv::PropertyValue value ) {
+	Atom property_atom( property );
+
+	if( !AddRule( selector, property_atom, std::move( value ) ) ) {
+		return false;
+	}
+
+	StyleChangeList changes;
+	AddStyleChange( changes, selector, property_atom );
+
+	ApplyStyleChanges( changes );
+
+	return true;
+}
+
+bool Engine::AddRule( sfg::Selector::Ptr selector, const Atom& property, priv::PropertyValue value ) {
 	if( !selector ) {
 		// Invalid selector string given.
 		return false;
@@ -324,25 +583,66 @@ bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& proper
 	// If the selector does already exist, we'll remove it to make sure the newly
 	// added value will get a higher priority than the previous one, because
 	// that's the expected behaviour (LIFO).
-	SelectorValueList& list( m_properties[property][selector->GetWidgetName()] ); // Shortcut.
-	SelectorValueList::iterator list_begin( list.begin() );
-	SelectorValueList::iterator list_end( list.end() );
-
-	for( ; list_begin != list_end; ++list_begin ) {
-		if( *list_begin->first == *selector ) {
-			// Equal, remove.
-			list.erase( list_begin );
-			break;
-		}
+	auto id = property.GetId();
+
+	if( id >= m_property_indices.size() ) {
+		m_property_indices.resize( id + 1, no_property );
+	}
+
+	if( m_property_indices[id] == no_property ) {
+		m_property_indices[id] = m_properties.size();
+		m_properties.emplace_back();
 	}
 
-	// Insert at top to get highest priority.
-	list.insert( list.begin(), SelectorValuePair( selector, value ) );
+	auto& list = GetRuleList( m_properties[m_property_indices[id]], *selector );
 
-	if( m_auto_refresh ) {
-		Widget::RefreshAll();
+	auto iter = std::find_if( list.begin(), list.end(), [&selector]( const Rule& rule ) {
+		return *rule.selector == *selector;
+	} );
+
+	if( iter != list.end() ) {
+		// Equal, remove.
+		list.erase( iter );
 	}
 
+	// Only the root of the selector has to match an ancestor of
+	// the widget in every case, the others might be skipped.
+	priv::AncestorFilter ancestors;
+
+	if( selector->GetParent() ) {
+		auto root = selector->GetParent();
+
+		while( root->GetParent() ) {
+			root = root->GetParent();
+		}
+
+		const auto& name = root->GetWidgetNameAtom();
+
+		if( ( name != Atom() ) && ( name != wildcard ) ) {
+			ancestors.AddName( name );
+		}
+
+		if( !root->GetId().empty() ) {
+			ancestors.AddId( root->GetId() );
+		}
+
+		if( !root->GetClass().empty() ) {
+			ancestors.AddClass( root->GetClass() );
+		}
+	}
+
+	const auto& name = selector->GetWidgetNameAtom();
+
+	// The serial makes the new rule win over older ones with the same score.
+	list.push_back( Rule{
+		selector,
+		std::move( value ),
+		ancestors,
+		selector->GetScore(),
+		( name != Atom() ) && ( name != wildcard ),
+		++m_rule_serial
+	} );
+
 	return true;
 }
 
@@ -355,70 +655,273 @@ bool Engine::SetProperties( const std::string& properties ) {
 
 	ParseTheme( theme );
 
-	if( m_auto_refresh ) {
-		Widget::RefreshAll();
-	}
-
 	return true;
 }
 
 void Engine::ClearProperties() {
 	m_properties.clear();
+	m_property_indices.clear();
+	m_selectors.clear();
+
+	InvalidateResolvedStyles();
 }
 
 void Engine::SetAutoRefresh( bool enable ) {
 	m_auto_refresh = enable;
 }
 
+void Engine::SetDefaultProperties( const DefaultProperty* properties, std::size_t count ) {
+	StyleChangeList changes;
+	Selector::Ptr selector;
+
+	for( std::size_t index = 0; index < count; ++index ) {
+		const auto& default_property = properties[index];
+
+		// Defaults are usually grouped by widget, share their selectors.
+		if( !selector || ( selector->GetWidgetName() != default_property.widget ) || ( std::strcmp( default_property.state, properties[index - 1].state ) != 0 ) ) {
+			selector = Selector::Create( default_property.widget, "", "", default_property.state, Selector::HierarchyType::ROOT, Selector::Ptr() );
+		}
+
+		Atom property( default_property.property );
+
+		switch( default_property.type ) {
+			case DefaultProperty::Type::COLOR:
+				AddRule( selector, property, priv::PropertyValue( sf::Color(
+					static_cast<sf::Uint8>( ( default_property.color >> 24 ) & 0xff ),
+					static_cast<sf::Uint8>( ( default_property.color >> 16 ) & 0xff ),
+					static_cast<sf::Uint8>( ( default_property.color >> 8 ) & 0xff ),
+					static_cast<sf::Uint8>( default_property.color & 0xff )
+				) ) );
+				break;
+			case DefaultProperty::Type::FLOAT:
+				AddRule( selector, property, priv::PropertyValue( default_property.number ) );
+				break;
+			case DefaultProperty::Type::INT:
+				AddRule( selector, property, priv::PropertyValue( default_property.integer ) );
+				break;
+			case DefaultProperty::Type::STRING:
+				AddRule( selector, property, priv::PropertyValue( std::string( default_property.string ) ) );
+				break;
+		}
+
+		AddStyleChange( changes, selector, property );
+	}
+
+	ApplyStyleChanges( changes );
+}
+
 void Engine::ParseTheme( const parser::theme::Theme& theme_to_parse ) {
+	StyleChangeList changes;
+
 	// Iterate over all rules
 	for( const auto& rule : theme_to_parse ) {
-		Selector::Ptr selector;
+		for( const auto& selector : CreateSelectors( rule ) ) {
+			// Iterate over all declarations
+			for( const auto& declaration : rule.m_declarations ) {
+				Atom property( declaration.m_property_name );
+
+				// Finally set the property
+				if( AddRule( selector, property, priv::PropertyValue( declaration.m_property_value ) ) ) {
+					AddStyleChange( changes, selector, property );
+				}
+			}
+		}
+	}
+
+	ApplyStyleChanges( changes );
+}
+
+std::vector<Selector::Ptr> Engine::CreateSelectors( const parser::theme::Rule& rule ) {
+	std::vector<Selector::Ptr> selectors;
+	Selector::Ptr selector;
+
+	// Iterate over all simple selectors
+	for( const auto& simple_selector : rule.m_selector.m_simple_selectors ) {
+		auto hierarchy = Selector::HierarchyType::ROOT;
+
+		if( simple_selector.m_combinator == ">" ) {
+			hierarchy = Selector::HierarchyType::CHILD;
+		}
+		else if( simple_selector.m_combinator == " " ) {
+			hierarchy = Selector::HierarchyType::DESCENDANT;
+		}
+		else if( simple_selector.m_combinator == "," ) {
+			// Grouping combinator detected. Stop eating simple selectors.
+			selectors.push_back( selector );
+
+			// Reset the current simple selector to be the root of a new chain.
+			selector = Selector::Ptr();
+		}
+
+		selector = Selector::Create(
+			simple_selector.m_type_selector,
+			simple_selector.m_id_selector,
+			simple_selector.m_class_selector,
+			simple_selector.m_state_selector,
+			hierarchy,
+			selector
+		);
+	}
+
+	selectors.push_back( selector );
+
+	return selectors;
+}
+
+Selector::Ptr Engine::ParseSelector( const std::string& selector ) {
+	auto iter = m_selectors.find( selector );
+
+	if( iter != m_selectors.end() ) {
+		return iter->second;
+	}
+
+	auto theme = parser::theme::ParseString( selector + " {}" );
+
+	if( theme.size() != 1 ) {
+		return Selector::Ptr();
+	}
+
+	auto selectors = CreateSelectors( theme.front() );
+
+	if( ( selectors.size() != 1 ) || !selectors.front() ) {
+		return Selector::Ptr();
+	}
 
-		// Iterate over all simple selectors
-		for( const auto& simple_selector : rule.m_selector.m_simple_selectors ) {
-			auto hierarchy = Selector::HierarchyType::ROOT;
+	// Every distinct string is cached, e.g. when theming widgets by
+	// their IDs at runtime. Start over instead of growing without bound.
+	if( m_selectors.size() >= max_cached_selectors ) {
+		m_selectors.clear();
+	}
+
+	// Selectors are immutable and can be shared by all rules using them.
+	m_selectors[selector] = selectors.front();
+
+	return selectors.front();
+}
+
+void Engine::AddStyleChange( StyleChangeList& changes, std::shared_ptr<const Selector> selector, const Atom& property ) {
+	auto layout = AffectsLayout( property );
+
+	// Rules of a theme usually set multiple properties.
+	if( !changes.empty() && ( changes.back().selector == selector ) ) {
+		changes.back().layout = changes.back().layout || layout;
+		return;
+	}
 
-			if( simple_selector.m_combinator == ">" ) {
-				hierarchy = Selector::HierarchyType::CHILD;
+	changes.push_back( StyleChange{ selector, layout } );
+}
+
+void Engine::ApplyStyleChanges( const StyleChangeList& changes ) {
+	if( changes.empty() ) {
+		return;
+	}
+
+	InvalidateResolvedStyles();
+
+	if( m_auto_refresh ) {
+		RefreshWidgets( changes );
+	}
+}
+
+void Engine::RefreshWidgets( const StyleChangeList& changes ) const {
+	// Bucket the changes the same way GetRuleList() buckets rules.
+	StyleChangeIndex index;
+
+	for( const auto& change : changes ) {
+		const auto& selector = *change.selector;
+		const auto& name = selector.GetWidgetNameAtom();
+
+		if( !selector.GetId().empty() ) {
+			index.id_changes[selector.GetId()].push_back( change );
+		}
+		else if( !selector.GetClass().empty() ) {
+			index.class_changes[selector.GetClass()].push_back( change );
+		}
+		else if( ( name != Atom() ) && ( name != wildcard ) ) {
+			auto iter = std::find_if( index.name_changes.begin(), index.name_changes.end(), [&name]( const std::pair<Atom, StyleChangeList>& name_changes ) {
+				return name_changes.first == name;
+			} );
+
+			if( iter == index.name_changes.end() ) {
+				index.name_changes.emplace_back( name, StyleChangeList() );
+				iter = index.name_changes.end() - 1;
 			}
-			else if( simple_selector.m_combinator == " " ) {
-				hierarchy = Selector::HierarchyType::DESCENDANT;
+
+			iter->second.push_back( change );
+		}
+		else {
+			index.other_changes.push_back( change );
+		}
+	}
+
+	// Only widgets matched by a changed selector can be affected.
+	// Copy the roots, refreshing them might add or remove some.
+	auto root_widgets = Widget::GetRootWidgets();
+
+	for( const auto& root_widget : root_widgets ) {
+		RefreshWidget( root_widget->shared_from_this(), index );
+	}
+}
+
+void Engine::RefreshWidget( Widget::Ptr widget, const StyleChangeIndex& changes ) const {
+	auto container = std::dynamic_pointer_cast<Container>( widget );
+
+	if( container ) {
+		for( const auto& child : container->GetChildren() ) {
+			RefreshWidget( child, changes );
+		}
+	}
+
+	auto matched = false;
+	auto layout = false;
+
+	auto match = [&widget, &matched, &layout]( const StyleChangeList& bucket ) {
+		for( const auto& change : bucket ) {
+			if( layout ) {
+				return;
 			}
-			else if( simple_selector.m_combinator == "," ) {
-				// Grouping combinator detected. Stop eating simple selectors and set the properties now.
-				// Iterate over all declarations
-				for( const auto& declaration : rule.m_declarations ) {
-					auto property_name = declaration.m_property_name;
-					auto property_value = declaration.m_property_value;
-
-					// Finally set the property
-					SetProperty( selector, property_name, property_value );
-				}
 
-				// Reset the current simple selector to be the root of a new chain.
-				selector = Selector::Ptr();
+			if( change.selector->Matches( widget ) ) {
+				matched = true;
+				layout = change.layout;
 			}
+		}
+	};
 
-			selector = Selector::Create(
-				simple_selector.m_type_selector,
-				simple_selector.m_id_selector,
-				simple_selector.m_class_selector,
-				simple_selector.m_state_selector,
-				hierarchy,
-				selector
-			);
+	if( !widget->GetId().empty() ) {
+		auto iter = changes.id_changes.find( widget->GetId() );
+
+		if( iter != changes.id_changes.end() ) {
+			match( iter->second );
 		}
+	}
 
-		// Iterate over all declarations
-		for( const auto& declaration : rule.m_declarations ) {
-			auto property_name = declaration.m_property_name;
-			auto property_value = declaration.m_property_value;
+	if( !widget->GetClass().empty() ) {
+		auto iter = changes.class_changes.find( widget->GetClass() );
 
-			// Finally set the property
-			SetProperty( selector, property_name, property_value );
+		if( iter != changes.class_changes.end() ) {
+			match( iter->second );
+		}
+	}
+
+	for( const auto& name_changes : changes.name_changes ) {
+		if( name_changes.first == widget->GetNameAtom() ) {
+			match( name_changes.second );
+			break;
 		}
 	}
+
+	match( changes.other_changes );
+
+	if( !matched ) {
+		return;
+	}
+
+	if( layout ) {
+		widget->RequestResize();
+	}
+
+	widget->Invalidate();
 }
 
 }
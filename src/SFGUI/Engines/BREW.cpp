@@ -4,154 +4,181 @@
 
 #include <cmath>
 
-namespace sfg {
-namespace eng {
+namespace {
 
-BREW::BREW()
-{
-	ResetProperties();
+typedef sfg::Engine::DefaultProperty DefaultProperty;
+
+constexpr DefaultProperty ColorProperty( const char* widget, const char* state, const char* property, sf::Uint32 r, sf::Uint32 g, sf::Uint32 b ) {
+	return DefaultProperty{ widget, state, property, DefaultProperty::Type::COLOR, r << 24 | g << 16 | b << 8 | 0xff, 0.f, 0, nullptr };
 }
 
-void BREW::ResetProperties() {
-	// Disable automatic widget refreshing while we set all these properties.
-	SetAutoRefresh( false );
+constexpr DefaultProperty FloatProperty( const char* widget, const char* state, const char* property, float value ) {
+	return DefaultProperty{ widget, state, property, DefaultProperty::Type::FLOAT, 0, value, 0, nullptr };
+}
 
-	ClearProperties();
+constexpr DefaultProperty IntProperty( const char* widget, const char* state, const char* property, int value ) {
+	return DefaultProperty{ widget, state, property, DefaultProperty::Type::INT, 0, 0.f, value, nullptr };
+}
 
-	// Set defaults.
-	SetProperty( "*", "Color", sf::Color( 0xc6, 0xcb, 0xc4 ) );
-	SetProperty( "*", "FontSize", 12 );
-	SetProperty( "*", "FontName", "Default" ); // Use default SFGUI font when available.
-	SetProperty( "*", "BackgroundColor", sf::Color( 0x46, 0x46, 0x46 ) );
-	SetProperty( "*", "BorderColor", sf::Color( 0x66, 0x66, 0x66 ) );
-	SetProperty( "*", "BorderColorShift", 0x20 );
-	SetProperty( "*", "BorderWidth", 1.f );
-	SetProperty( "*", "Padding", 5.f );
-	SetProperty( "*", "Thickness", 2.f );
+constexpr DefaultProperty StringProperty( const char* widget, const char* state, const char* property, const char* value ) {
+	return DefaultProperty{ widget, state, property, DefaultProperty::Type::STRING, 0, 0.f, 0, value };
+}
+
+// Built at compile time, installing it doesn't involve any parsing.
+constexpr DefaultProperty default_properties[] = {
+	// All widgets.
+	ColorProperty( "*", "", "Color", 0xc6, 0xcb, 0xc4 ),
+	IntProperty( "*", "", "FontSize", 12 ),
+	StringProperty( "*", "", "FontName", "Default" ), // Use default SFGUI font when available.
+	ColorProperty( "*", "", "BackgroundColor", 0x46, 0x46, 0x46 ),
+	ColorProperty( "*", "", "BorderColor", 0x66, 0x66, 0x66 ),
+	IntProperty( "*", "", "BorderColorShift", 0x20 ),
+	FloatProperty( "*", "", "BorderWidth", 1.f ),
+	FloatProperty( "*", "", "Padding", 5.f ),
+	FloatProperty( "*", "", "Thickness", 2.f ),
 
 	// Window-specific.
-	SetProperty( "Window", "Gap", 10.f );
-	SetProperty( "Window", "BorderColor", sf::Color( 0x5a, 0x6a, 0x50 ) );
-	SetProperty( "Window", "BorderColorShift", 0 );
-	SetProperty( "Window", "TitleBackgroundColor", sf::Color( 0x5a, 0x6a, 0x50 ) );
-	SetProperty( "Window", "TitlePadding", 5.f );
-	SetProperty( "Window", "HandleSize", 10.f );
-	SetProperty( "Window", "ShadowDistance", 3.f );
-	SetProperty( "Window", "ShadowAlpha", 100.f );
-	SetProperty( "Window", "CloseHeight", 10.f );
-	SetProperty( "Window", "CloseThickness", 3.f );
+	FloatProperty( "Window", "", "Gap", 10.f ),
+	ColorProperty( "Window", "", "BorderColor", 0x5a, 0x6a, 0x50 ),
+	IntProperty( "Window", "", "BorderColorShift", 0 ),
+	ColorProperty( "Window", "", "TitleBackgroundColor", 0x5a, 0x6a, 0x50 ),
+	FloatProperty( "Window", "", "TitlePadding", 5.f ),
+	FloatProperty( "Window", "", "HandleSize", 10.f ),
+	FloatProperty( "Window", "", "ShadowDistance", 3.f ),
+	FloatProperty( "Window", "", "ShadowAlpha", 100.f ),
+	FloatProperty( "Window", "", "CloseHeight", 10.f ),
+	FloatProperty( "Window", "", "CloseThickness", 3.f ),
 
 	// Button-specific.
-	SetProperty( "Button", "BackgroundColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "Button", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "Button", "Spacing", 5.f );
-	SetProperty( "Button:PRELIGHT", "BackgroundColor", sf::Color( 0x65, 0x67, 0x62 ) );
-	SetProperty( "Button:PRELIGHT", "Color", sf::Color::White );
-	SetProperty( "Button:ACTIVE", "BackgroundColor", sf::Color( 0x55, 0x55, 0x55 ) );
-	SetProperty( "Button:ACTIVE", "Color", sf::Color::Black );
+	ColorProperty( "Button", "", "BackgroundColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "Button", "", "BorderColor", 0x55, 0x57, 0x52 ),
+	FloatProperty( "Button", "", "Spacing", 5.f ),
+	ColorProperty( "Button", "PRELIGHT", "BackgroundColor", 0x65, 0x67, 0x62 ),
+	ColorProperty( "Button", "PRELIGHT", "Color", 0xff, 0xff, 0xff ),
+	ColorProperty( "Button", "ACTIVE", "BackgroundColor", 0x55, 0x55, 0x55 ),
+	ColorProperty( "Button", "ACTIVE", "Color", 0x00, 0x00, 0x00 ),
 
 	// ToggleButton-specific.
-	SetProperty( "ToggleButton", "BackgroundColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "ToggleButton", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "ToggleButton", "Padding", 5.f );
-	SetProperty( "ToggleButton:PRELIGHT", "BackgroundColor", sf::Color( 0x65, 0x67, 0x62 ) );
-	SetProperty( "ToggleButton:PRELIGHT", "Color", sf::Color::White );
-	SetProperty( "ToggleButton:ACTIVE", "BackgroundColor", sf::Color( 0x55, 0x55, 0x55 ) );
-	SetProperty( "ToggleButton:ACTIVE", "Color", sf::Color::Black );
+	ColorProperty( "ToggleButton", "", "BackgroundColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "ToggleButton", "", "BorderColor", 0x55, 0x57, 0x52 ),
+	FloatProperty( "ToggleButton", "", "Padding", 5.f ),
+	ColorProperty( "ToggleButton", "PRELIGHT", "BackgroundColor", 0x65, 0x67, 0x62 ),
+	ColorProperty( "ToggleButton", "PRELIGHT", "Color", 0xff, 0xff, 0xff ),
+	ColorProperty( "ToggleButton", "ACTIVE", "BackgroundColor", 0x55, 0x55, 0x55 ),
+	ColorProperty( "ToggleButton", "ACTIVE", "Color", 0x00, 0x00, 0x00 ),
 
 	// CheckButton-specific.
-	SetProperty( "CheckButton", "Spacing", 5.f );
-	SetProperty( "CheckButton", "BoxSize", 14.f );
-	SetProperty( "CheckButton", "CheckSize", 6.f );
-	SetProperty( "CheckButton", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "CheckButton", "BackgroundColor", sf::Color( 0x36, 0x36, 0x36 ) );
-	SetProperty( "CheckButton", "CheckColor", sf::Color( 0x9e, 0x9e, 0x9e ) );
-	SetProperty( "CheckButton:PRELIGHT", "BackgroundColor", sf::Color( 0x46, 0x46, 0x46 ) );
-	SetProperty( "CheckButton:ACTIVE", "BackgroundColor", sf::Color( 0x56, 0x56, 0x56 ) );
+	FloatProperty( "CheckButton", "", "Spacing", 5.f ),
+	FloatProperty( "CheckButton", "", "BoxSize", 14.f ),
+	FloatProperty( "CheckButton", "", "CheckSize", 6.f ),
+	ColorProperty( "CheckButton", "", "BorderColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "CheckButton", "", "BackgroundColor", 0x36, 0x36, 0x36 ),
+	ColorProperty( "CheckButton", "", "CheckColor", 0x9e, 0x9e, 0x9e ),
+	ColorProperty( "CheckButton", "PRELIGHT", "BackgroundColor", 0x46, 0x46, 0x46 ),
+	ColorProperty( "CheckButton", "ACTIVE", "BackgroundColor", 0x56, 0x56, 0x56 ),
 
 	// RadioButton-specific.
-	SetProperty( "RadioButton", "Spacing", 5.f );
-	SetProperty( "RadioButton", "BoxSize", 14.f );
-	SetProperty( "RadioButton", "CheckSize", 6.f );
-	SetProperty( "RadioButton", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "RadioButton", "BackgroundColor", sf::Color( 0x36, 0x36, 0x36 ) );
-	SetProperty( "RadioButton", "CheckColor", sf::Color( 0x9e, 0x9e, 0x9e ) );
-	SetProperty( "RadioButton:PRELIGHT", "BackgroundColor", sf::Color( 0x46, 0x46, 0x46 ) );
-	SetProperty( "RadioButton:ACTIVE", "BackgroundColor", sf::Color( 0x56, 0x56, 0x56 ) );
+	FloatProperty( "RadioButton", "", "Spacing", 5.f ),
+	FloatProperty( "RadioButton", "", "BoxSize", 14.f ),
+	FloatProperty( "RadioButton", "", "CheckSize", 6.f ),
+	ColorProperty( "RadioButton", "", "BorderColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "RadioButton", "", "BackgroundColor", 0x36, 0x36, 0x36 ),
+	ColorProperty( "RadioButton", "", "CheckColor", 0x9e, 0x9e, 0x9e ),
+	ColorProperty( "RadioButton", "PRELIGHT", "BackgroundColor", 0x46, 0x46, 0x46 ),
+	ColorProperty( "RadioButton", "ACTIVE", "BackgroundColor", 0x56, 0x56, 0x56 ),
 
 	// Entry-specific.
-	SetProperty( "Entry", "BackgroundColor", sf::Color( 0x5e, 0x5e, 0x5e ) );
-	SetProperty( "Entry", "Color", sf::Color::White );
+	ColorProperty( "Entry", "", "BackgroundColor", 0x5e, 0x5e, 0x5e ),
+	ColorProperty( "Entry", "", "Color", 0xff, 0xff, 0xff ),
 
 	// Scale-specific.
-	SetProperty( "Scale", "SliderColor", sf::Color( 0x68, 0x6a, 0x65 ) );
-	SetProperty( "Scale", "SliderLength", 15.f );
-	SetProperty( "Scale", "TroughColor", sf::Color( 0x70, 0x70, 0x70 ) );
-	SetProperty( "Scale", "TroughWidth", 5.f );
+	ColorProperty( "Scale", "", "SliderColor", 0x68, 0x6a, 0x65 ),
+	FloatProperty( "Scale", "", "SliderLength", 15.f ),
+	ColorProperty( "Scale", "", "TroughColor", 0x70, 0x70, 0x70 ),
+	FloatProperty( "Scale", "", "TroughWidth", 5.f ),
 
 	// Scrollbar-specific.
-	SetProperty( "Scrollbar", "SliderColor", sf::Color( 0x68, 0x6a, 0x65 ) );
-	SetProperty( "Scrollbar", "TroughColor", sf::Color( 0x70, 0x70, 0x70 ) );
-	SetProperty( "Scrollbar", "StepperBackgroundColor", sf::Color( 0x68, 0x6a, 0x65 ) );
-	SetProperty( "Scrollbar", "StepperArrowColor", sf::Color( 0xd9, 0xdc, 0xd5 ) );
-	SetProperty( "Scrollbar", "StepperSpeed", 10.f );
-	SetProperty( "Scrollbar", "StepperRepeatDelay", 300 );
-	SetProperty( "Scrollbar", "SliderMinimumLength", 15.f );
+	ColorProperty( "Scrollbar", "", "SliderColor", 0x68, 0x6a, 0x65 ),
+	ColorProperty( "Scrollbar", "", "TroughColor", 0x70, 0x70, 0x70 ),
+	ColorProperty( "Scrollbar", "", "StepperBackgroundColor", 0x68, 0x6a, 0x65 ),
+	ColorProperty( "Scrollbar", "", "StepperArrowColor", 0xd9, 0xdc, 0xd5 ),
+	FloatProperty( "Scrollbar", "", "StepperSpeed", 10.f ),
+	IntProperty( "Scrollbar", "", "StepperRepeatDelay", 300 ),
+	FloatProperty( "Scrollbar", "", "SliderMinimumLength", 15.f ),
 
 	// ScrolledWindow-specific.
-	SetProperty( "ScrolledWindow", "ScrollbarWidth", 20.f );
-	SetProperty( "ScrolledWindow", "ScrollbarSpacing", 5.f );
-	SetProperty( "ScrolledWindow", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
+	FloatProperty( "ScrolledWindow", "", "ScrollbarWidth", 20.f ),
+	FloatProperty( "ScrolledWindow", "", "ScrollbarSpacing", 5.f ),
+	ColorProperty( "ScrolledWindow", "", "BorderColor", 0x55, 0x57, 0x52 ),
 
 	// ProgressBar-specific.
-	SetProperty( "ProgressBar", "BackgroundColor", sf::Color( 0x36, 0x36, 0x36 ) );
-	SetProperty( "ProgressBar", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "ProgressBar", "BarColor", sf::Color( 0x67, 0x89, 0xab ) );
-	SetProperty( "ProgressBar", "BarBorderColor", sf::Color( 0x67, 0x89, 0xab ) );
-	SetProperty( "ProgressBar", "BarBorderColorShift", 0x20 );
-	SetProperty( "ProgressBar", "BarBorderWidth", 1.f );
+	ColorProperty( "ProgressBar", "", "BackgroundColor", 0x36, 0x36, 0x36 ),
+	ColorProperty( "ProgressBar", "", "BorderColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "ProgressBar", "", "BarColor", 0x67, 0x89, 0xab ),
+	ColorProperty( "ProgressBar", "", "BarBorderColor", 0x67, 0x89, 0xab ),
+	IntProperty( "ProgressBar", "", "BarBorderColorShift", 0x20 ),
+	FloatProperty( "ProgressBar", "", "BarBorderWidth", 1.f ),
 
 	// Separator-specific.
-	SetProperty( "Separator", "Color", sf::Color( 0x75, 0x77, 0x72 ) );
+	ColorProperty( "Separator", "", "Color", 0x75, 0x77, 0x72 ),
 
 	// Frame-specific.
-	SetProperty( "Frame", "BorderColor", sf::Color( 0x75, 0x77, 0x72 ) );
-	SetProperty( "Frame", "Padding", 7.f );
-	SetProperty( "Frame", "LabelPadding", 5.f );
+	ColorProperty( "Frame", "", "BorderColor", 0x75, 0x77, 0x72 ),
+	FloatProperty( "Frame", "", "Padding", 7.f ),
+	FloatProperty( "Frame", "", "LabelPadding", 5.f ),
 
 	// Notebook-specific.
-	SetProperty( "Notebook", "BorderColor", sf::Color( 0x50, 0x52, 0x4D ) );
-	SetProperty( "Notebook", "BackgroundColor", sf::Color( 0x4C, 0x4C, 0x4C ) );
-	SetProperty( "Notebook", "BackgroundColorDark", sf::Color( 0x42, 0x42, 0x42 ) );
-	SetProperty( "Notebook", "BackgroundColorPrelight", sf::Color( 0x48, 0x48, 0x48 ) );
-	SetProperty( "Notebook", "ScrollButtonSize", 20.f );
-	SetProperty( "Notebook", "ScrollButtonPrelightColor", sf::Color( 0x65, 0x67, 0x62 ) );
-	SetProperty( "Notebook", "ScrollSpeed", 2.f );
+	ColorProperty( "Notebook", "", "BorderColor", 0x50, 0x52, 0x4D ),
+	ColorProperty( "Notebook", "", "BackgroundColor", 0x4C, 0x4C, 0x4C ),
+	ColorProperty( "Notebook", "", "BackgroundColorDark", 0x42, 0x42, 0x42 ),
+	ColorProperty( "Notebook", "", "BackgroundColorPrelight", 0x48, 0x48, 0x48 ),
+	FloatProperty( "Notebook", "", "ScrollButtonSize", 20.f ),
+	ColorProperty( "Notebook", "", "ScrollButtonPrelightColor", 0x65, 0x67, 0x62 ),
+	FloatProperty( "Notebook", "", "ScrollSpeed", 2.f ),
 
 	// Spinner-specific.
-	SetProperty( "Spinner", "CycleDuration", 800.f );
-	SetProperty( "Spinner", "Steps", 13 );
-	SetProperty( "Spinner", "StoppedAlpha", 47 );
-	SetProperty( "Spinner", "InnerRadius", 8.f );
-	SetProperty( "Spinner", "RodThickness", 3.f );
+	FloatProperty( "Spinner", "", "CycleDuration", 800.f ),
+	IntProperty( "Spinner", "", "Steps", 13 ),
+	IntProperty( "Spinner", "", "StoppedAlpha", 47 ),
+	FloatProperty( "Spinner", "", "InnerRadius", 8.f ),
+	FloatProperty( "Spinner", "", "RodThickness", 3.f ),
 
 	// ComboBox-specific.
-	SetProperty( "ComboBox", "BackgroundColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "ComboBox", "BorderColor", sf::Color( 0x55, 0x57, 0x52 ) );
-	SetProperty( "ComboBox", "HighlightedColor", sf::Color( 0x65, 0x67, 0x62 ) );
-	SetProperty( "ComboBox", "ArrowColor", sf::Color( 0xc6, 0xcb, 0xc4 ) );
-	SetProperty( "ComboBox", "ItemPadding", 4.f );
-	SetProperty( "ComboBox:PRELIGHT", "BackgroundColor", sf::Color( 0x65, 0x67, 0x62 ) );
-	SetProperty( "ComboBox:ACTIVE", "BackgroundColor", sf::Color( 0x55, 0x55, 0x55 ) );
+	ColorProperty( "ComboBox", "", "BackgroundColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "ComboBox", "", "BorderColor", 0x55, 0x57, 0x52 ),
+	ColorProperty( "ComboBox", "", "HighlightedColor", 0x65, 0x67, 0x62 ),
+	ColorProperty( "ComboBox", "", "ArrowColor", 0xc6, 0xcb, 0xc4 ),
+	FloatProperty( "ComboBox", "", "ItemPadding", 4.f ),
+	ColorProperty( "ComboBox", "PRELIGHT", "BackgroundColor", 0x65, 0x67, 0x62 ),
+	ColorProperty( "ComboBox", "ACTIVE", "BackgroundColor", 0x55, 0x55, 0x55 ),
 
 	// SpinButton-specific.
-	SetProperty( "SpinButton", "BackgroundColor", sf::Color( 0x5e, 0x5e, 0x5e ) );
-	SetProperty( "SpinButton", "Color", sf::Color::White );
-	SetProperty( "SpinButton", "StepperAspectRatio", 1.2f );
-	SetProperty( "SpinButton", "StepperBackgroundColor", sf::Color( 0x68, 0x6a, 0x65 ) );
-	SetProperty( "SpinButton", "StepperArrowColor", sf::Color( 0xd9, 0xdc, 0xd5 ) );
-	SetProperty( "SpinButton", "StepperSpeed", 10.f );
-	SetProperty( "SpinButton", "StepperRepeatDelay", 500 );
+	ColorProperty( "SpinButton", "", "BackgroundColor", 0x5e, 0x5e, 0x5e ),
+	ColorProperty( "SpinButton", "", "Color", 0xff, 0xff, 0xff ),
+	FloatProperty( "SpinButton", "", "StepperAspectRatio", 1.2f ),
+	ColorProperty( "SpinButton", "", "StepperBackgroundColor", 0x68, 0x6a, 0x65 ),
+	ColorProperty( "SpinButton", "", "StepperArrowColor", 0xd9, 0xdc, 0xd5 ),
+	FloatProperty( "SpinButton", "", "StepperSpeed", 10.f ),
+	IntProperty( "SpinButton", "", "StepperRepeatDelay", 500 )
+};
+
+}
+
+namespace sfg {
+namespace eng {
+
+BREW::BREW()
+{
+	ResetProperties();
+}
+
+void BREW::ResetProperties() {
+	// Disable automatic widget refreshing while we set all these properties.
+	SetAutoRefresh( false );
+
+	ClearProperties();
+
+	SetDefaultProperties( default_properties, sizeof( default_properties ) / sizeof( default_properties[0] ) );
 
 	// (Re)Enable automatic widget refreshing after we are done setting all these properties.
 	SetAutoRefresh( true );
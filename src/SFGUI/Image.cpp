@@ -10,7 +10,8 @@
 
 namespace sfg {
 
-Image::Image( const sf::Image& image )
+Image::Image( const sf::Image& image ) :
+	m_request_serial( 0 )
 {
 	SetAlignment( sf::Vector2f( .5f, .5f ) );
 	SetImage( image );
@@ -21,6 +22,9 @@ Image::Ptr Image::Create( const sf::Image& image ) {
 }
 
 void Image::SetImage( const sf::Image& image ) {
+	// Don't let a pending request replace this image later.
+	++m_request_serial;
+
 	if( !image.getSize().x || !image.getSize().y ) {
 		return;
 	}
@@ -42,6 +46,23 @@ const sf::Image& Image::GetImage() const {
 	return m_image;
 }
 
+void Image::SetImageAsync( const std::string& path ) {
+	auto serial = ++m_request_serial;
+	std::weak_ptr<Image> weak_this( std::static_pointer_cast<Image>( shared_from_this() ) );
+
+	// The callback runs on the GUI thread, so uploading
+	// the image to the renderer in SetImage() is safe.
+	Context::Get().GetEngine().GetResourceManager().GetImageAsync( path, [weak_this, serial]( std::shared_ptr<const sf::Image> image ) {
+		auto self = weak_this.lock();
+
+		if( !self || !image || ( self->m_request_serial != serial ) ) {
+			return;
+		}
+
+		self->SetImage( *image );
+	} );
+}
+
 std::unique_ptr<RenderQueue> Image::InvalidateImpl() const {
 	std::unique_ptr<RenderQueue> queue = Context::Get().GetEngine().CreateImageDrawable( std::dynamic_pointer_cast<const Image>( shared_from_this() ) );
 
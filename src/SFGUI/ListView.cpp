@@ -0,0 +1,475 @@
+#include <SFGUI/ListView.hpp>
+#include <SFGUI/Viewport.hpp>
+#include <SFGUI/Adjustment.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+const auto no_item = std::numeric_limits<std::size_t>::max();
+const auto no_row = std::numeric_limits<std::size_t>::max();
+
+// Least significant set bit, used to walk the height tree.
+std::size_t LowestBit( std::size_t index ) {
+	return index & ( ~index + 1 );
+}
+
+}
+
+namespace sfg {
+
+ListView::RowInfo::RowInfo( Widget::Ptr widget_ ) :
+	widget( widget_ ),
+	item( no_item )
+{
+}
+
+ListView::ListView( RowFactory factory, RowBinder binder, float row_height, RowHeightMode mode ) :
+	m_factory( factory ),
+	m_binder( binder ),
+	m_first_item( 0 ),
+	m_item_count( 0 ),
+	m_adjustment_signal_serial( 0 ),
+	m_row_height( std::max( row_height, 1.f ) ),
+	m_row_height_mode( mode ),
+	m_view_top( 0.f ),
+	m_view_height( 0.f ),
+	m_updating_rows( false ),
+	m_rows_invalid( false ),
+	m_heights_changed( false )
+{
+}
+
+ListView::Ptr ListView::Create( RowFactory factory, RowBinder binder, float row_height, RowHeightMode mode ) {
+	return Ptr( new ListView( factory, binder, row_height, mode ) );
+}
+
+const std::string& ListView::GetName() const {
+	static const std::string name( "ListView" );
+	return name;
+}
+
+void ListView::SetItemCount( std::size_t count ) {
+	m_item_count = count;
+
+	ResetRows();
+	ResetItemHeights();
+	UpdateRows();
+}
+
+std::size_t ListView::GetItemCount() const {
+	return m_item_count;
+}
+
+void ListView::SetRowHeight( float row_height, RowHeightMode mode ) {
+	m_row_height = std::max( row_height, 1.f );
+	m_row_height_mode = mode;
+
+	ResetRows();
+	ResetItemHeights();
+	UpdateRows();
+}
+
+float ListView::GetRowHeight() const {
+	return m_row_height;
+}
+
+ListView::RowHeightMode ListView::GetRowHeightMode() const {
+	return m_row_height_mode;
+}
+
+void ListView::UpdateItem( std::size_t item ) {
+	if( ( item < m_first_item ) || ( item - m_first_item >= m_visible_rows.size() ) ) {
+		return;
+	}
+
+	auto row = m_visible_rows[item - m_first_item];
+
+	if( row != no_row ) {
+		BindRow( m_rows[row], item );
+		UpdateRows();
+	}
+}
+
+void ListView::UpdateItems() {
+	ResetRows();
+	UpdateRows();
+}
+
+float ListView::GetItemOffset( std::size_t item ) const {
+	item = std::min( item, m_item_count );
+
+	if( m_row_height_mode == RowHeightMode::FIXED ) {
+		return static_cast<float>( item ) * m_row_height;
+	}
+
+	// Prefix sum over the height tree.
+	auto offset = 0.f;
+
+	for( auto index = item; index > 0; index -= LowestBit( index ) ) {
+		offset += m_height_tree[index];
+	}
+
+	return offset;
+}
+
+std::size_t ListView::GetItemAt( float offset ) const {
+	if( !m_item_count ) {
+		return m_item_count;
+	}
+
+	if( offset <= 0.f ) {
+		return 0;
+	}
+
+	if( m_row_height_mode == RowHeightMode::FIXED ) {
+		return std::min( static_cast<std::size_t>( offset / m_row_height ), m_item_count - 1 );
+	}
+
+	// Descend the height tree to find the number of items
+	// that end at or before the given offset.
+	std::size_t step = 1;
+
+	while( ( step << 1 ) <= m_item_count ) {
+		step <<= 1;
+	}
+
+	std::size_t item = 0;
+
+	for( ; step > 0; step >>= 1 ) {
+		if( ( item + step <= m_item_count ) && ( m_height_tree[item + step] <= offset ) ) {
+			item += step;
+			offset -= m_height_tree[item];
+		}
+	}
+
+	return std::min( item, m_item_count - 1 );
+}
+
+void ListView::HandleChildRequisitionChange( Widget::PtrConst child ) {
+	// Rows are measured right after being bound anyway.
+	if( m_updating_rows || ( m_row_height_mode != RowHeightMode::ESTIMATED ) ) {
+		return;
+	}
+
+	for( auto& row : m_rows ) {
+		if( ( row.widget == child ) && ( row.item != no_item ) ) {
+			auto height = std::max( row.widget->GetRequisition().y, 1.f );
+
+			if( height != GetItemHeight( row.item ) ) {
+				SetItemHeight( row.item, height );
+				UpdateRows();
+			}
+
+			return;
+		}
+	}
+}
+
+sf::Vector2f ListView::CalculateRequisition() {
+	sf::Vector2f requisition( 0.f, GetTotalHeight() );
+
+	for( const auto& row : m_rows ) {
+		if( row.item != no_item ) {
+			requisition.x = std::max( requisition.x, row.widget->GetRequisition().x );
+		}
+	}
+
+	return requisition;
+}
+
+bool ListView::HandleAdd( Widget::Ptr child ) {
+	// Rows are created by the list view itself, adding widgets
+	// manually is not allowed for this class.
+	auto iter = std::find_if( m_rows.begin(), m_rows.end(), [&child]( const RowInfo& row ) {
+		return row.widget == child;
+	} );
+
+	if( iter == m_rows.end() ) {
+
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Children of sfg::ListView widgets are created by its row factory.\n";
+#endif
+
+		return false;
+	}
+
+	return Container::HandleAdd( child );
+}
+
+void ListView::HandleRemove( Widget::Ptr child ) {
+	auto iter = std::find_if( m_rows.begin(), m_rows.end(), [&child]( const RowInfo& row ) {
+		return row.widget == child;
+	} );
+
+	if( iter != m_rows.end() ) {
+		m_rows.erase( iter );
+
+		// Row indices changed, the remaining rows are bound again.
+		ResetRows();
+	}
+
+	RequestResize();
+}
+
+void ListView::HandleSizeChange() {
+	UpdateRows();
+}
+
+void ListView::HandleViewportUpdate() {
+	Container::HandleViewportUpdate();
+
+	// The viewport we were added to resized or got another adjustment.
+	ConnectAdjustment();
+
+	if( UpdateView() ) {
+		UpdateRows();
+	}
+}
+
+void ListView::ConnectAdjustment() {
+	auto viewport = std::dynamic_pointer_cast<Viewport>( GetParent() );
+	auto adjustment = viewport ? viewport->GetVerticalAdjustment() : Adjustment::Ptr();
+	auto old_adjustment = m_adjustment.lock();
+
+	if( adjustment == old_adjustment ) {
+		return;
+	}
+
+	if( old_adjustment ) {
+		old_adjustment->GetSignal( Adjustment::OnChange ).Disconnect( m_adjustment_signal_serial );
+	}
+
+	m_adjustment = adjustment;
+
+	if( !adjustment ) {
+		return;
+	}
+
+	auto weak_this = std::weak_ptr<Widget>( shared_from_this() );
+
+	// Rebind rows as soon as the view is scrolled, so they are
+	// up to date when the viewport is drawn the next time.
+	m_adjustment_signal_serial = adjustment->GetSignal( Adjustment::OnChange ).Connect( [weak_this] {
+		auto shared_this = weak_this.lock();
+
+		if( !shared_this ) {
+			return;
+		}
+
+		auto list_view = std::dynamic_pointer_cast<ListView>( shared_this );
+
+		if( list_view && list_view->UpdateView() ) {
+			list_view->UpdateRows();
+		}
+	} );
+}
+
+bool ListView::UpdateView() {
+	auto view_top = 0.f;
+	auto view_height = GetAllocation().height;
+
+	auto parent = GetParent();
+	auto viewport = std::dynamic_pointer_cast<Viewport>( parent );
+
+	// Without a parent our allocation is our whole requisition,
+	// no rows are needed until we are placed inside a viewport.
+	if( !parent ) {
+		view_height = 0.f;
+	}
+	else if( viewport ) {
+		view_top = viewport->GetVerticalAdjustment()->GetValue();
+		view_height = viewport->GetAllocation().height;
+	}
+
+	if( ( view_top == m_view_top ) && ( view_height == m_view_height ) ) {
+		return false;
+	}
+
+	m_view_top = view_top;
+	m_view_height = view_height;
+
+	return true;
+}
+
+void ListView::UpdateRows() {
+	// Adding, showing and binding rows causes resizes that end up
+	// here again. Just remember to do another pass in that case.
+	if( m_updating_rows ) {
+		m_rows_invalid = true;
+		return;
+	}
+
+	m_updating_rows = true;
+
+	do {
+		m_rows_invalid = false;
+
+		UpdateView();
+
+		std::size_t first_item = 0;
+		std::size_t end_item = 0;
+
+		if( m_item_count ) {
+			first_item = GetItemAt( m_view_top );
+			end_item = GetItemAt( m_view_top + m_view_height ) + 1;
+		}
+
+		// Release rows whose items went out of view.
+		while( !m_visible_rows.empty() && ( m_first_item < first_item ) ) {
+			ReleaseRow( m_visible_rows.front() );
+			m_visible_rows.pop_front();
+			++m_first_item;
+		}
+
+		while( !m_visible_rows.empty() && ( m_first_item + m_visible_rows.size() > end_item ) ) {
+			ReleaseRow( m_visible_rows.back() );
+			m_visible_rows.pop_back();
+		}
+
+		if( m_visible_rows.empty() ) {
+			m_first_item = first_item;
+		}
+
+		// Make room for items that became visible.
+		for( ; m_first_item > first_item; --m_first_item ) {
+			m_visible_rows.push_front( no_row );
+		}
+
+		m_visible_rows.resize( end_item - m_first_item, no_row );
+
+		// Bind items that became visible to free rows, only
+		// creating new rows if there are not enough.
+		for( std::size_t index = 0; index < m_visible_rows.size(); ++index ) {
+			auto& row = m_visible_rows[index];
+
+			if( row != no_row ) {
+				continue;
+			}
+
+			if( !m_free_rows.empty() ) {
+				row = m_free_rows.back();
+				m_free_rows.pop_back();
+			}
+			else {
+				auto widget = m_factory();
+
+				if( !widget ) {
+					break;
+				}
+
+				row = m_rows.size();
+				m_rows.emplace_back( widget );
+				Container::Add( widget );
+			}
+
+			BindRow( m_rows[row], m_first_item + index );
+		}
+
+		// Measured heights shift the following items, so the
+		// visible range has to be determined again.
+		if( m_heights_changed ) {
+			m_rows_invalid = true;
+		}
+
+		auto width = GetAllocation().width;
+
+		for( auto& row : m_rows ) {
+			if( row.item == no_item ) {
+				row.widget->Show( false );
+				continue;
+			}
+
+			row.widget->Show( true );
+			row.widget->SetAllocation( sf::FloatRect( 0.f, GetItemOffset( row.item ), width, GetItemHeight( row.item ) ) );
+		}
+
+		if( m_heights_changed ) {
+			m_heights_changed = false;
+			RequestResize();
+		}
+	} while( m_rows_invalid );
+
+	m_updating_rows = false;
+}
+
+void ListView::ResetRows() {
+	m_visible_rows.clear();
+	m_free_rows.clear();
+
+	for( std::size_t row = 0; row < m_rows.size(); ++row ) {
+		m_rows[row].item = no_item;
+		m_free_rows.push_back( row );
+	}
+}
+
+void ListView::ReleaseRow( std::size_t row ) {
+	if( row != no_row ) {
+		m_rows[row].item = no_item;
+		m_free_rows.push_back( row );
+	}
+}
+
+void ListView::BindRow( RowInfo& row, std::size_t item ) {
+	row.item = item;
+
+	m_binder( row.widget, item );
+
+	if( m_row_height_mode == RowHeightMode::ESTIMATED ) {
+		auto height = std::max( row.widget->GetRequisition().y, 1.f );
+
+		if( height != GetItemHeight( item ) ) {
+			SetItemHeight( item, height );
+		}
+	}
+}
+
+void ListView::ResetItemHeights() {
+	m_item_heights.clear();
+	m_height_tree.clear();
+
+	if( m_row_height_mode == RowHeightMode::ESTIMATED ) {
+		m_item_heights.assign( m_item_count, m_row_height );
+		m_height_tree.assign( m_item_count + 1, 0.f );
+
+		// Build the tree in linear time.
+		for( std::size_t index = 1; index <= m_item_count; ++index ) {
+			m_height_tree[index] += m_item_heights[index - 1];
+
+			auto parent = index + LowestBit( index );
+
+			if( parent <= m_item_count ) {
+				m_height_tree[parent] += m_height_tree[index];
+			}
+		}
+	}
+
+	m_heights_changed = true;
+}
+
+void ListView::SetItemHeight( std::size_t item, float height ) {
+	auto delta = height - m_item_heights[item];
+
+	m_item_heights[item] = height;
+
+	for( auto index = item + 1; index <= m_item_count; index += LowestBit( index ) ) {
+		m_height_tree[index] += delta;
+	}
+
+	m_heights_changed = true;
+}
+
+float ListView::GetItemHeight( std::size_t item ) const {
+	if( m_row_height_mode == RowHeightMode::FIXED ) {
+		return m_row_height;
+	}
+
+	return m_item_heights[item];
+}
+
+float ListView::GetTotalHeight() const {
+	return GetItemOffset( m_item_count );
+}
+
+}
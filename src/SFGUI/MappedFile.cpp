@@ -0,0 +1,93 @@
+#include <SFGUI/MappedFile.hpp>
+
+#if defined( SFGUI_SYSTEM_WINDOWS )
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace sfg {
+namespace priv {
+
+MappedFile::MappedFile( const std::string& path ) :
+	m_data( nullptr ),
+	m_size( 0 )
+{
+#if defined( SFGUI_SYSTEM_WINDOWS )
+	auto file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+
+	if( file == INVALID_HANDLE_VALUE ) {
+		return;
+	}
+
+	LARGE_INTEGER size;
+
+	if( GetFileSizeEx( file, &size ) && ( size.QuadPart > 0 ) ) {
+		auto mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+		if( mapping ) {
+			m_data = static_cast<const char*>( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+
+			if( m_data ) {
+				m_size = static_cast<std::size_t>( size.QuadPart );
+			}
+
+			// The view keeps the mapping alive.
+			CloseHandle( mapping );
+		}
+	}
+
+	CloseHandle( file );
+#else
+	auto file = open( path.c_str(), O_RDONLY );
+
+	if( file < 0 ) {
+		return;
+	}
+
+	struct stat status;
+
+	if( ( fstat( file, &status ) == 0 ) && ( status.st_size > 0 ) ) {
+		auto size = static_cast<std::size_t>( status.st_size );
+		auto data = mmap( nullptr, size, PROT_READ, MAP_PRIVATE, file, 0 );
+
+		if( data != MAP_FAILED ) {
+			m_data = static_cast<const char*>( data );
+			m_size = size;
+		}
+	}
+
+	// The mapping stays valid after closing the file.
+	close( file );
+#endif
+}
+
+MappedFile::~MappedFile() {
+	if( !m_data ) {
+		return;
+	}
+
+#if defined( SFGUI_SYSTEM_WINDOWS )
+	UnmapViewOfFile( m_data );
+#else
+	munmap( const_cast<char*>( m_data ), m_size );
+#endif
+}
+
+bool MappedFile::IsOpen() const {
+	return m_data != nullptr;
+}
+
+const char* MappedFile::GetData() const {
+	return m_data;
+}
+
+std::size_t MappedFile::GetSize() const {
+	return m_size;
+}
+
+}
+}
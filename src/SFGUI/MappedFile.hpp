@@ -0,0 +1,49 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <string>
+#include <cstddef>
+
+namespace sfg {
+namespace priv {
+
+/** Read-only memory mapping of a whole file.
+ */
+class MappedFile {
+	public:
+		/** Ctor.
+		 * @param path Path of the file to map.
+		 */
+		MappedFile( const std::string& path );
+
+		/** Dtor.
+		 */
+		~MappedFile();
+
+		MappedFile( const MappedFile& ) = delete;
+		MappedFile& operator=( const MappedFile& ) = delete;
+
+		/** Check whether the file could be mapped.
+		 * Empty files can't be mapped.
+		 * @return true if mapped.
+		 */
+		bool IsOpen() const;
+
+		/** Get mapped data.
+		 * @return Start of the mapping or nullptr if not mapped.
+		 */
+		const char* GetData() const;
+
+		/** Get size of the mapping.
+		 * @return Size in bytes.
+		 */
+		std::size_t GetSize() const;
+
+	private:
+		const char* m_data;
+		std::size_t m_size;
+};
+
+}
+}
@@ -0,0 +1,57 @@
+#include <SFGUI/MappedResourceLoader.hpp>
+#include <SFGUI/MappedFile.hpp>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <memory>
+
+namespace {
+
+// sf::Font only references the memory it was loaded from,
+// so the mapping has to live exactly as long as the font.
+struct MappedFont {
+	MappedFont( const std::string& path ) :
+		file( path )
+	{
+	}
+
+	sfg::priv::MappedFile file;
+	sf::Font font;
+};
+
+}
+
+namespace sfg {
+
+std::shared_ptr<const sf::Font> MappedResourceLoader::LoadFont( const std::string& path ) const {
+	auto mapped_font = std::make_shared<MappedFont>( path );
+
+	if( !mapped_font->file.IsOpen() || !mapped_font->font.loadFromMemory( mapped_font->file.GetData(), mapped_font->file.GetSize() ) ) {
+		return std::shared_ptr<const sf::Font>();
+	}
+
+	return std::shared_ptr<const sf::Font>( mapped_font, &mapped_font->font );
+}
+
+std::shared_ptr<const sf::Image> MappedResourceLoader::LoadImage( const std::string& path ) const {
+	priv::MappedFile file( path );
+
+	if( !file.IsOpen() ) {
+		return std::shared_ptr<const sf::Image>();
+	}
+
+	auto image = std::make_shared<sf::Image>();
+
+	if( !image->loadFromMemory( file.GetData(), file.GetSize() ) ) {
+		return std::shared_ptr<const sf::Image>();
+	}
+
+	return image;
+}
+
+const std::string& MappedResourceLoader::GetIdentifier() const {
+	static const std::string id( "mmap" );
+	return id;
+}
+
+}
@@ -1,132 +1,327 @@
-#include <SFGUI/Parsers/ThemeParser/Grammar.hpp>
 #include <SFGUI/Parsers/ThemeParser/Parse.hpp>
 
 #include <vector>
 #include <string>
 #include <fstream>
+#include <iterator>
+#include <algorithm>
 
-namespace sfg {
-namespace parser {
-namespace theme {
+#if defined( SFGUI_DEBUG )
+#include <iostream>
+#endif
 
-static ThemeGrammar _grammar;
+namespace {
 
-std::string GetLine( std::string str, std::size_t line ) {
-	for( std::size_t current_line = 1; current_line < line; ++current_line ) {
-		auto position = str.find( '\n' );
-		if( ( position == std::string::npos ) || ( position == ( str.size() - 1 ) ) ) {
-			return std::string("");
-		}
+using sfg::parser::theme::Rule;
+using sfg::parser::theme::Selector;
+using sfg::parser::theme::SimpleSelector;
+using sfg::parser::theme::Theme;
 
-		str.erase( 0, position + 1 );
-	}
+// Thrown when the theme doesn't match the grammar.
+struct ParseError {
+	const char* position;
+	const char* expected;
+};
 
-	str.erase( str.find( '\n' ) );
+bool IsBlank( char character ) {
+	return ( character == ' ' ) || ( character == '\t' ) || ( character == '\n' ) || ( character == '\r' ) || ( character == '\v' );
+}
 
-	return str;
+bool IsAlpha( char character ) {
+	return ( ( character >= 'a' ) && ( character <= 'z' ) ) || ( ( character >= 'A' ) && ( character <= 'Z' ) ) || ( character == '_' );
 }
 
-std::size_t ColumnPosition( std::string str, std::size_t string_position ) {
-	std::size_t column_position = 0;
+bool IsAlnum( char character ) {
+	return IsAlpha( character ) || ( ( character >= '0' ) && ( character <= '9' ) );
+}
 
-	if( string_position >= str.size() ) {
-		return 0;
-	}
+bool IsIdentifierCharacter( char character ) {
+	return IsAlnum( character ) || ( character == '-' );
+}
 
-	for( std::size_t index = 0; ( index < string_position ) && ( index < str.size() ); ++index ) {
-		++column_position;
+bool IsValueCharacter( char character ) {
+	return IsAlnum( character ) || ( character == '.' ) || ( character == '#' ) || ( character == ' ' ) || ( character == '/' ) || ( character == '-' );
+}
+
+bool StartsSimpleSelector( char character ) {
+	return IsAlpha( character ) || ( character == '*' ) || ( character == '.' ) || ( character == ':' ) || ( character == '#' );
+}
+
+/** Recursive descent parser for themes.
+ *
+ * theme           = { rule }
+ * rule            = selector '{' { declaration } '}'
+ * declaration     = identifier ':' value ';'
+ * selector        = simple-selector { [ '>' | ',' ] simple-selector }
+ * simple-selector = ( type | '*' ) { part } | part { part }
+ * part            = '.' class | ':' state | '#' id
+ *
+ * Blanks and comments are allowed between all tokens, simple selectors only
+ * separated by them are combined as descendants. A simple selector contains
+ * each kind of part at most once, a repeated part starts a descendant.
+ * Identifiers and values are single tokens, values may contain spaces.
+ */
+class ThemeParser {
+	public:
+		ThemeParser( const char* begin, const char* end ) :
+			m_position( begin ),
+			m_end( end )
+		{
+		}
 
-		if( str[ index ] == '\n' ) {
-			column_position = 0;
+		Theme Parse() {
+			Theme theme;
+
+			Skip();
+
+			while( Peek() != '\0' ) {
+				if( !StartsSimpleSelector( Peek() ) ) {
+					throw ParseError{ m_position, "selector or end of theme" };
+				}
+
+				theme.emplace_back();
+				ReadRule( theme.back() );
+			}
+
+			return theme;
+		}
+
+	private:
+		// Null characters end the theme, like they did for the previous parser.
+		char Peek( std::size_t offset = 0 ) const {
+			return ( static_cast<std::size_t>( m_end - m_position ) > offset ) ? m_position[offset] : '\0';
+		}
+
+		void Skip() {
+			while( true ) {
+				if( IsBlank( Peek() ) ) {
+					++m_position;
+				}
+				else if( ( Peek() == '/' ) && ( Peek( 1 ) == '*' ) ) {
+					m_position += 2;
+
+					while( ( Peek() != '*' ) || ( Peek( 1 ) != '/' ) ) {
+						if( Peek() == '\0' ) {
+							throw ParseError{ m_position, "end of comment" };
+						}
+
+						++m_position;
+					}
+
+					m_position += 2;
+				}
+				else {
+					return;
+				}
+			}
+		}
+
+		void Expect( char character, const char* expected ) {
+			if( Peek() != character ) {
+				throw ParseError{ m_position, expected };
+			}
+
+			++m_position;
+			Skip();
+		}
+
+		void ReadIdentifier( std::string& identifier, const char* expected ) {
+			if( !IsAlpha( Peek() ) ) {
+				throw ParseError{ m_position, expected };
+			}
+
+			auto begin = m_position;
+
+			while( IsIdentifierCharacter( Peek() ) ) {
+				++m_position;
+			}
+
+			identifier.assign( begin, m_position );
+			Skip();
+		}
+
+		void ReadValue( std::string& value ) {
+			if( !IsValueCharacter( Peek() ) ) {
+				throw ParseError{ m_position, "value" };
+			}
+
+			auto begin = m_position;
+
+			while( IsValueCharacter( Peek() ) ) {
+				++m_position;
+			}
+
+			// Trailing spaces are part of the value.
+			value.assign( begin, m_position );
+			Skip();
+		}
+
+		void ReadRule( Rule& rule ) {
+			ReadSelector( rule.m_selector );
+			Expect( '{', "'{'" );
+
+			while( IsAlpha( Peek() ) ) {
+				rule.m_declarations.emplace_back();
+				auto& declaration = rule.m_declarations.back();
+
+				ReadIdentifier( declaration.m_property_name, "property" );
+				Expect( ':', "':'" );
+				ReadValue( declaration.m_property_value );
+				Expect( ';', "';'" );
+			}
+
+			Expect( '}', "declaration or '}'" );
+		}
+
+		void ReadSelector( Selector& selector ) {
+			const char* combinator = "";
+
+			while( true ) {
+				selector.m_simple_selectors.emplace_back();
+				auto& simple_selector = selector.m_simple_selectors.back();
+
+				ReadSimpleSelector( simple_selector );
+				simple_selector.m_combinator = combinator;
+
+				if( ( Peek() == '>' ) || ( Peek() == ',' ) ) {
+					combinator = ( Peek() == '>' ) ? ">" : ",";
+
+					++m_position;
+					Skip();
+
+					if( !StartsSimpleSelector( Peek() ) ) {
+						throw ParseError{ m_position, "simple selector" };
+					}
+				}
+				else if( StartsSimpleSelector( Peek() ) ) {
+					combinator = " ";
+				}
+				else {
+					return;
+				}
+			}
+		}
+
+		void ReadSimpleSelector( SimpleSelector& simple_selector ) {
+			simple_selector.m_type_selector = "*";
+
+			if( Peek() == '*' ) {
+				++m_position;
+				Skip();
+			}
+			else if( IsAlpha( Peek() ) ) {
+				ReadIdentifier( simple_selector.m_type_selector, "type" );
+			}
+
+			auto has_class = false;
+			auto has_state = false;
+			auto has_id = false;
+
+			while( true ) {
+				if( ( Peek() == '.' ) && !has_class ) {
+					++m_position;
+					Skip();
+					ReadIdentifier( simple_selector.m_class_selector, "class" );
+					has_class = true;
+				}
+				else if( ( Peek() == ':' ) && !has_state ) {
+					++m_position;
+					Skip();
+					ReadIdentifier( simple_selector.m_state_selector, "state" );
+					has_state = true;
+				}
+				else if( ( Peek() == '#' ) && !has_id ) {
+					++m_position;
+					Skip();
+					ReadIdentifier( simple_selector.m_id_selector, "ID" );
+					has_id = true;
+				}
+				else {
+					return;
+				}
+			}
+		}
+
+		const char* m_position;
+		const char* m_end;
+};
+
+#if defined( SFGUI_DEBUG )
+void PrintError( const char* data, std::size_t size, const ParseError& error, const std::string& source ) {
+	// Line information is only needed when reporting errors.
+	std::size_t line = 1;
+	auto line_begin = data;
+
+	for( auto position = data; position != error.position; ++position ) {
+		if( *position == '\n' ) {
+			++line;
+			line_begin = position + 1;
 		}
 	}
 
-	return column_position;
+	auto line_end = std::find( line_begin, data + size, '\n' );
+
+	std::cerr << "Error parsing " << source << " at line " << line << ":\n"
+	 << std::string( line_begin, line_end ) << "\n"
+	 << std::string( static_cast<std::size_t>( error.position - line_begin ), ' ' ) << "^\n"
+	 << "Expected " << error.expected << "\n";
+}
+#endif
+
 }
 
-std::vector<Rule> ParseString( std::string str ) {
-	_grammar.ClearResults();
-	//ELL_ENABLE_DUMP( grammar );
+namespace sfg {
+namespace parser {
+namespace theme {
 
-	auto result = false;
+std::vector<Rule> ParseString( const std::string& str ) {
+	return ParseString( str.data(), str.size() );
+}
 
-	std::vector<Rule> rules;
+std::vector<Rule> ParseString( const char* data, std::size_t size ) {
+	ThemeParser parser( data, data + size );
 
 	try {
-		_grammar.parse( str.c_str() );
-		rules = _grammar.GetTheme();
-		result = true;
+		return parser.Parse();
 	}
 #if defined( SFGUI_DEBUG )
-	catch( const std::runtime_error& e ) {
-		result = false;
-
-		std::cerr << "Error parsing string:\n"
-		 << str << "\n"
-		 << std::string( static_cast<std::size_t>( _grammar.position - str.c_str() ), ' ' ) << "^\n"
-		 << "Expected " << strstr( e.what(), "expecting " ) + 10 << "\n";
+	catch( const ParseError& error ) {
+		PrintError( data, size, error, "string" );
 	}
 #else
-	catch( const std::runtime_error& /*e*/ ) {
-		result = false;
+	catch( const ParseError& /*error*/ ) {
 	}
 #endif
 
-	if( result && ( _grammar.get() == '\0' ) ) {
-		return rules;
-	}
-
 	return std::vector<Rule>();
 }
 
-std::vector<Rule> ParseFile( std::string filename ) {
-	_grammar.ClearResults();
-	//ELL_ENABLE_DUMP( grammar );
-
-	auto result = false;
-
-	std::vector<Rule> rules;
-
+std::vector<Rule> ParseFile( const std::string& filename ) {
 	std::ifstream file( filename.c_str(), std::ifstream::in );
-	file.unsetf( std::ios::skipws );
 
 	if( !file.good() ) {
 #if defined( SFGUI_DEBUG )
 		std::cerr << "Error opening file: " << filename << "\n";
 #endif
-		file.close();
 		return std::vector<Rule>();
 	}
 
 	auto str = std::string( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
 
+	ThemeParser parser( str.data(), str.data() + str.size() );
+
 	try {
-		_grammar.parse( str.c_str() );
-		rules = _grammar.GetTheme();
-		result = true;
+		return parser.Parse();
 	}
 #if defined( SFGUI_DEBUG )
-	catch( const std::runtime_error& e ) {
-		result = false;
-
-		std::cerr << "Error parsing file \"" << filename << "\" at line " << _grammar.line_number <<":\n"
-		 << GetLine( str, static_cast<std::size_t>( _grammar.line_number ) ) << "\n"
-		 << std::string( ColumnPosition( str, static_cast<std::size_t>( _grammar.position - str.c_str() ) ), ' ' ) << "^\n"
-		 << "Expected " << strstr( e.what(), "expecting " ) + 10 << "\n";
+	catch( const ParseError& error ) {
+		PrintError( str.data(), str.size(), error, "file \"" + filename + "\"" );
 	}
 #else
-	catch( const std::runtime_error& /*e*/ ) {
-		result = false;
+	catch( const ParseError& /*error*/ ) {
 	}
 #endif
 
-	if( result && ( _grammar.get() == '\0' ) ) {
-		file.close();
-		return rules;
-	}
-
-	file.close();
-
 	return std::vector<Rule>();
 }
 
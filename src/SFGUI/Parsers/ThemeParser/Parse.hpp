@@ -4,6 +4,7 @@
 
 #include <string>
 #include <vector>
+#include <cstddef>
 
 namespace sfg {
 namespace parser {
@@ -36,8 +37,25 @@ struct Rule {
 	std::vector<Declaration> m_declarations;
 };
 
-std::vector<Rule> ParseString( std::string str );
-std::vector<Rule> ParseFile( std::string filename );
+/** Parse a theme.
+ * The parser keeps no state between calls, themes can be parsed on multiple threads at once.
+ * @param str Theme data.
+ * @return Rules or empty vector if the theme couldn't be parsed.
+ */
+SFGUI_API std::vector<Rule> ParseString( const std::string& str );
+
+/** Parse a theme.
+ * @param data Theme data, parsing stops at a null character.
+ * @param size Size of data.
+ * @return Rules or empty vector if the theme couldn't be parsed.
+ */
+SFGUI_API std::vector<Rule> ParseString( const char* data, std::size_t size );
+
+/** Parse a theme file.
+ * @param filename Filename.
+ * @return Rules or empty vector if the file couldn't be read or parsed.
+ */
+SFGUI_API std::vector<Rule> ParseFile( const std::string& filename );
 
 typedef std::vector<Rule> Theme;
 
@@ -0,0 +1,177 @@
+#include <SFGUI/PropertyValue.hpp>
+#include <SFGUI/Engine.hpp>
+
+#include <sstream>
+#include <utility>
+#include <limits>
+
+namespace {
+
+// Converts the same way Engine::GetProperty() always did,
+// results must not differ from parsing the string later.
+template <typename T>
+bool Convert( const std::string& string, T& out ) {
+	std::istringstream sstr( string );
+	sstr >> out;
+
+	return !sstr.fail();
+}
+
+template <typename T>
+std::string Format( const T& value ) {
+	std::ostringstream sstr;
+	sstr << value;
+
+	return sstr.str();
+}
+
+}
+
+namespace sfg {
+namespace priv {
+
+PropertyValue::PropertyValue( std::string string ) :
+	m_string( std::move( string ) ),
+	m_float( 0.f ),
+	m_int( 0 ),
+	m_unsigned_int( 0 ),
+	m_types( STRING ),
+	m_source( STRING )
+{
+	if( Convert( m_string, m_color ) ) {
+		m_types |= COLOR;
+	}
+
+	if( Convert( m_string, m_float ) ) {
+		m_types |= FLOAT;
+	}
+
+	if( Convert( m_string, m_int ) ) {
+		m_types |= INT;
+	}
+
+	if( Convert( m_string, m_unsigned_int ) ) {
+		m_types |= UNSIGNED_INT;
+	}
+}
+
+PropertyValue::PropertyValue( const sf::Color& color ) :
+	m_color( color ),
+	m_float( 0.f ),
+	m_int( 0 ),
+	m_unsigned_int( 0 ),
+	m_types( COLOR ),
+	m_source( COLOR )
+{
+}
+
+PropertyValue::PropertyValue( float value ) :
+	m_float( value ),
+	m_int( 0 ),
+	m_unsigned_int( 0 ),
+	m_types( FLOAT ),
+	m_source( FLOAT )
+{
+	// Only whole numbers with up to six digits are formatted exactly.
+	// Anything else might be rounded, so take the value the string
+	// parses to, like it was when all properties were set as strings.
+	if( ( value > -1000000.f ) && ( value < 1000000.f ) && ( static_cast<float>( static_cast<int>( value ) ) == value ) ) {
+		m_int = static_cast<int>( value );
+		m_unsigned_int = static_cast<unsigned int>( m_int );
+		m_types |= INT | UNSIGNED_INT;
+	}
+	else {
+		*this = PropertyValue( Format( value ) );
+	}
+}
+
+PropertyValue::PropertyValue( int value ) :
+	m_float( static_cast<float>( value ) ),
+	m_int( value ),
+	m_unsigned_int( static_cast<unsigned int>( value ) ),
+	m_types( FLOAT | INT | UNSIGNED_INT ),
+	m_source( INT )
+{
+}
+
+PropertyValue::PropertyValue( unsigned int value ) :
+	m_float( static_cast<float>( value ) ),
+	m_int( 0 ),
+	m_unsigned_int( value ),
+	m_types( FLOAT | UNSIGNED_INT ),
+	m_source( UNSIGNED_INT )
+{
+	if( value <= static_cast<unsigned int>( std::numeric_limits<int>::max() ) ) {
+		m_int = static_cast<int>( value );
+		m_types |= INT;
+	}
+}
+
+const std::string& PropertyValue::GetString() const {
+	if( !( m_types & STRING ) ) {
+		switch( m_source ) {
+			case COLOR:
+				m_string = Format( m_color );
+				break;
+			case FLOAT:
+				m_string = Format( m_float );
+				break;
+			case INT:
+				m_string = Format( m_int );
+				break;
+			case UNSIGNED_INT:
+				m_string = Format( m_unsigned_int );
+				break;
+			default:
+				break;
+		}
+
+		m_types |= STRING;
+	}
+
+	return m_string;
+}
+
+bool PropertyValue::Get( std::string& out ) const {
+	out = GetString();
+	return true;
+}
+
+bool PropertyValue::Get( sf::Color& out ) const {
+	if( !( m_types & COLOR ) ) {
+		return false;
+	}
+
+	out = m_color;
+	return true;
+}
+
+bool PropertyValue::Get( float& out ) const {
+	if( !( m_types & FLOAT ) ) {
+		return false;
+	}
+
+	out = m_float;
+	return true;
+}
+
+bool PropertyValue::Get( int& out ) const {
+	if( !( m_types & INT ) ) {
+		return false;
+	}
+
+	out = m_int;
+	return true;
+}
+
+bool PropertyValue::Get( unsigned int& out ) const {
+	if( !( m_types & UNSIGNED_INT ) ) {
+		return false;
+	}
+
+	out = m_unsigned_int;
+	return true;
+}
+
+}
+}
@@ -78,7 +78,7 @@ void RenderQueue::SetZOrder( int z_order ) {
 		primitive->SetLayer( z_order );
 	}
 
-	Renderer::Get().Invalidate( sfg::Renderer::INVALIDATE_ALL );
+	Renderer::Get().InvalidatePrimitiveOrder();
 }
 
 void RenderQueue::Show( bool show ) {
@@ -98,7 +98,7 @@ void RenderQueue::SetLevel( int level ) {
 		primitive->SetLevel( level );
 	}
 
-	Renderer::Get().Invalidate( sfg::Renderer::INVALIDATE_ALL );
+	Renderer::Get().InvalidatePrimitiveOrder();
 }
 
 void RenderQueue::SetViewport( RendererViewport::Ptr viewport ) {
@@ -753,7 +753,7 @@ void Renderer::SortPrimitives() {
 	while( current_position < primitives_size ) {
 		sort_index = current_position++;
 
-		while( ( sort_index > 0 ) && ( m_primitives[sort_index - 1]->GetLayer() * 1048576 + m_primitives[sort_index - 1]->GetLevel() > m_primitives[sort_index]->GetLayer() * 1048576 + m_primitives[sort_index]->GetLevel() ) ) {
+		while( ( sort_index > 0 ) && IsDrawnBefore( *m_primitives[sort_index], *m_primitives[sort_index - 1] ) ) {
 			m_primitives[sort_index].swap( m_primitives[sort_index - 1] );
 			--sort_index;
 		}
@@ -762,6 +762,10 @@ void Renderer::SortPrimitives() {
 	m_primitives_sorted = true;
 }
 
+bool Renderer::IsDrawnBefore( const Primitive& first, const Primitive& second ) {
+	return first.GetLayer() * 1048576 + first.GetLevel() < second.GetLayer() * 1048576 + second.GetLevel();
+}
+
 void Renderer::AddPrimitive( Primitive::Ptr primitive ) {
 	m_primitives.push_back( primitive );
 
@@ -801,6 +805,18 @@ void Renderer::Invalidate( unsigned char datasets ) {
 	InvalidateImpl( datasets );
 }
 
+void Renderer::InvalidatePrimitiveOrder() {
+	// Already pending, the renderer sorts once before its next sync.
+	if( !m_primitives_sorted ) {
+		return;
+	}
+
+	m_primitives_sorted = false;
+
+	// The vertex data stays where it is, only the draw order changes.
+	Invalidate( INVALIDATE_INDEX );
+}
+
 void Renderer::Redraw() {
 	m_force_redraw = true;
 }
@@ -16,5 +16,14 @@ struct RendererBatch {
 	bool custom_draw;
 };
 
+// Where a primitive's vertices ended up during the last full refresh.
+// Lets a renderer rebuild only its indices when just the draw order changed.
+struct RendererSpan {
+	const Primitive* primitive;
+	std::shared_ptr<RendererViewport> viewport;
+	int atlas_page;
+	int first_vertex;
+};
+
 }
 }
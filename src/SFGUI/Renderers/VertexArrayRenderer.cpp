@@ -11,6 +11,7 @@
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/OpenGL.hpp>
+#include <algorithm>
 
 namespace sfg {
 
@@ -18,6 +19,7 @@ VertexArrayRenderer::VertexArrayRenderer() :
 	m_last_vertex_count( 0 ),
 	m_last_index_count( 0 ),
 	m_alpha_threshold( 0.f ),
+	m_sync_type( INVALIDATE_ALL ),
 	m_dirty( true ),
 	m_cull( false ) {
 }
@@ -215,12 +217,25 @@ void VertexArrayRenderer::DisplayImpl() const {
 }
 
 void VertexArrayRenderer::RefreshArray() {
+	// A change of draw order alone leaves the vertex data untouched.
+	if( m_sync_type == INVALIDATE_INDEX ) {
+		RefreshIndices();
+	}
+	else {
+		RefreshVertices();
+	}
+
+	m_sync_type = 0;
+}
+
+void VertexArrayRenderer::RefreshVertices() {
 	SortPrimitives();
 
 	m_vertex_data.clear();
 	m_color_data.clear();
 	m_texture_data.clear();
 	m_index_data.clear();
+	m_spans.clear();
 
 	m_vertex_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
 	m_color_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
@@ -282,6 +297,8 @@ void VertexArrayRenderer::RefreshArray() {
 		const std::shared_ptr<Signal>& custom_draw_callback( primitive->GetCustomDrawCallback() );
 
 		if( custom_draw_callback ) {
+			m_spans.push_back( { primitive, viewport, 0, 0 } );
+
 			// Start a new batch.
 			current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
 			m_batches.push_back( current_batch );
@@ -366,6 +383,8 @@ void VertexArrayRenderer::RefreshArray() {
 				m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
 			}
 			else {
+				m_spans.push_back( { primitive, viewport, atlas_page, m_last_vertex_count } );
+
 				for( const auto& index : indices ) {
 					m_index_data.push_back( m_last_vertex_count + static_cast<int>( index ) );
 				}
@@ -396,6 +415,86 @@ void VertexArrayRenderer::RefreshArray() {
 	m_batches.push_back( current_batch );
 }
 
+void VertexArrayRenderer::RefreshIndices() {
+	SortPrimitives();
+
+	std::stable_sort( m_spans.begin(), m_spans.end(), []( const priv::RendererSpan& first, const priv::RendererSpan& second ) {
+		return IsDrawnBefore( *first.primitive, *second.primitive );
+	} );
+
+	m_index_data.clear();
+
+	m_batches.clear();
+
+	m_last_index_count = 0;
+
+	// The vertices stay in the order of the last full refresh,
+	// so any batch might reference any of them.
+	auto max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
+
+	priv::RendererBatch current_batch;
+	current_batch.viewport = m_default_viewport;
+	current_batch.atlas_page = 0;
+	current_batch.start_index = 0;
+	current_batch.index_count = 0;
+	current_batch.min_index = 0;
+	current_batch.max_index = max_index;
+	current_batch.custom_draw = false;
+
+	for( const auto& span : m_spans ) {
+		const auto& custom_draw_callback = span.primitive->GetCustomDrawCallback();
+
+		if( custom_draw_callback ) {
+			// Start a new batch.
+			m_batches.push_back( current_batch );
+
+			// Mark current_batch custom draw batch.
+			current_batch.viewport = span.viewport;
+			current_batch.start_index = 0;
+			current_batch.index_count = 0;
+			current_batch.min_index = 0;
+			current_batch.max_index = 0;
+			current_batch.custom_draw = true;
+			current_batch.custom_draw_callback = custom_draw_callback;
+
+			// Start a new batch.
+			m_batches.push_back( current_batch );
+
+			// Reset current_batch to defaults.
+			current_batch.viewport = m_default_viewport;
+			current_batch.start_index = m_last_index_count;
+			current_batch.index_count = 0;
+			current_batch.max_index = max_index;
+			current_batch.custom_draw = false;
+		}
+		else {
+			const std::vector<GLuint>& indices( span.primitive->GetIndices() );
+
+			for( const auto& index : indices ) {
+				m_index_data.push_back( span.first_vertex + static_cast<int>( index ) );
+			}
+
+			// Check if we need to start a new batch.
+			if( ( ( *span.viewport ) != ( *current_batch.viewport ) ) || ( span.atlas_page != current_batch.atlas_page ) ) {
+				m_batches.push_back( current_batch );
+
+				// Reset current_batch to defaults.
+				current_batch.viewport = span.viewport;
+				current_batch.atlas_page = span.atlas_page;
+				current_batch.start_index = m_last_index_count;
+				current_batch.index_count = 0;
+				current_batch.custom_draw = false;
+			}
+
+			current_batch.index_count += static_cast<int>( indices.size() );
+
+			m_last_index_count += static_cast<GLsizei>( indices.size() );
+		}
+	}
+
+	m_batches.push_back( current_batch );
+}
+
 void VertexArrayRenderer::TuneAlphaThreshold( float alpha_threshold ) {
 	m_alpha_threshold = alpha_threshold;
 }
@@ -404,7 +503,8 @@ void VertexArrayRenderer::TuneCull( bool enable ) {
 	m_cull = enable;
 }
 
-void VertexArrayRenderer::InvalidateImpl( unsigned char /*datasets*/ ) {
+void VertexArrayRenderer::InvalidateImpl( unsigned char datasets ) {
+	m_sync_type |= datasets;
 	m_dirty = true;
 }
 
@@ -21,6 +21,7 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/System/Vector3.hpp>
+#include <algorithm>
 
 #define GLEXT_framebuffer_object sfgogl_ext_EXT_framebuffer_object
 
@@ -380,12 +381,71 @@ void VertexBufferRenderer::DisplayImpl() const {
 }
 
 void VertexBufferRenderer::RefreshVBO() {
+	// A change of draw order alone leaves the vertex data untouched.
+	if( m_vbo_sync_type == INVALIDATE_INDEX ) {
+		RefreshIndices();
+	}
+	else {
+		RefreshVertices();
+	}
+
+	if( !m_vertex_data.empty() && !m_color_data.empty() && !m_texture_data.empty() ) {
+		if( m_vbo_sync_type & INVALIDATE_VERTEX ) {
+			// Sync vertex data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector3f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_vertex_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector2f ) ), m_vertex_data.data() ) );
+			}
+		}
+
+		if( m_vbo_sync_type & INVALIDATE_COLOR ) {
+			// Sync color data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_color_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), m_color_data.data() ) );
+			}
+		}
+
+		if( m_vbo_sync_type & INVALIDATE_TEXTURE ) {
+			// Sync texture coord data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_texture_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), m_texture_data.data() ) );
+			}
+		}
+
+		if( m_vbo_sync_type & INVALIDATE_INDEX ) {
+			// Sync index data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_index_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), m_index_data.data() ) );
+			}
+
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
+		}
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+
+	m_vbo_sync_type = 0;
+}
+
+void VertexBufferRenderer::RefreshVertices() {
 	SortPrimitives();
 
 	m_vertex_data.clear();
 	m_color_data.clear();
 	m_texture_data.clear();
 	m_index_data.clear();
+	m_spans.clear();
 
 	m_vertex_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
 	m_color_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
@@ -445,6 +505,8 @@ void VertexBufferRenderer::RefreshVBO() {
 		const auto& custom_draw_callback = primitive->GetCustomDrawCallback();
 
 		if( custom_draw_callback ) {
+			m_spans.push_back( { primitive, viewport, 0, 0 } );
+
 			// Start a new batch.
 			current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
 			m_batches.push_back( current_batch );
@@ -529,6 +591,8 @@ void VertexBufferRenderer::RefreshVBO() {
 				m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
 			}
 			else {
+				m_spans.push_back( { primitive, viewport, atlas_page, m_last_vertex_count } );
+
 				for( const auto& index : indices ) {
 					m_index_data.push_back( static_cast<unsigned int>( m_last_vertex_count ) + index );
 				}
@@ -557,54 +621,86 @@ void VertexBufferRenderer::RefreshVBO() {
 
 	current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
 	m_batches.push_back( current_batch );
+}
 
-	if( !m_vertex_data.empty() && !m_color_data.empty() && !m_texture_data.empty() ) {
-		if( m_vbo_sync_type & INVALIDATE_VERTEX ) {
-			// Sync vertex data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector3f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+void VertexBufferRenderer::RefreshIndices() {
+	SortPrimitives();
 
-			if( m_vertex_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector2f ) ), m_vertex_data.data() ) );
-			}
-		}
+	std::stable_sort( m_spans.begin(), m_spans.end(), []( const priv::RendererSpan& first, const priv::RendererSpan& second ) {
+		return IsDrawnBefore( *first.primitive, *second.primitive );
+	} );
 
-		if( m_vbo_sync_type & INVALIDATE_COLOR ) {
-			// Sync color data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+	m_index_data.clear();
 
-			if( m_color_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), m_color_data.data() ) );
-			}
-		}
+	m_batches.clear();
 
-		if( m_vbo_sync_type & INVALIDATE_TEXTURE ) {
-			// Sync texture coord data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+	m_last_index_count = 0;
 
-			if( m_texture_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), m_texture_data.data() ) );
-			}
+	// The vertices stay in the order of the last full refresh,
+	// so any batch might reference any of them.
+	auto max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
+
+	priv::RendererBatch current_batch;
+	current_batch.viewport = m_default_viewport;
+	current_batch.atlas_page = 0;
+	current_batch.start_index = 0;
+	current_batch.index_count = 0;
+	current_batch.min_index = 0;
+	current_batch.max_index = max_index;
+	current_batch.custom_draw = false;
+
+	for( const auto& span : m_spans ) {
+		const auto& custom_draw_callback = span.primitive->GetCustomDrawCallback();
+
+		if( custom_draw_callback ) {
+			// Start a new batch.
+			m_batches.push_back( current_batch );
+
+			// Mark current_batch custom draw batch.
+			current_batch.viewport = span.viewport;
+			current_batch.start_index = 0;
+			current_batch.index_count = 0;
+			current_batch.min_index = 0;
+			current_batch.max_index = 0;
+			current_batch.custom_draw = true;
+			current_batch.custom_draw_callback = custom_draw_callback;
+
+			// Start a new batch.
+			m_batches.push_back( current_batch );
+
+			// Reset current_batch to defaults.
+			current_batch.viewport = m_default_viewport;
+			current_batch.start_index = m_last_index_count;
+			current_batch.index_count = 0;
+			current_batch.max_index = max_index;
+			current_batch.custom_draw = false;
 		}
+		else {
+			const std::vector<GLuint>& indices( span.primitive->GetIndices() );
 
-		if( m_vbo_sync_type & INVALIDATE_INDEX ) {
-			// Sync index data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+			for( const auto& index : indices ) {
+				m_index_data.push_back( static_cast<unsigned int>( span.first_vertex ) + index );
+			}
 
-			if( m_index_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), m_index_data.data() ) );
+			// Check if we need to start a new batch.
+			if( ( ( *span.viewport ) != ( *current_batch.viewport ) ) || ( span.atlas_page != current_batch.atlas_page ) ) {
+				m_batches.push_back( current_batch );
+
+				// Reset current_batch to defaults.
+				current_batch.viewport = span.viewport;
+				current_batch.atlas_page = span.atlas_page;
+				current_batch.start_index = m_last_index_count;
+				current_batch.index_count = 0;
+				current_batch.custom_draw = false;
 			}
 
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
+			current_batch.index_count += static_cast<int>( indices.size() );
+
+			m_last_index_count += static_cast<GLsizei>( indices.size() );
 		}
 	}
 
-	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
-
-	m_vbo_sync_type = 0;
+	m_batches.push_back( current_batch );
 }
 
 void VertexBufferRenderer::InvalidateVBO( unsigned char datasets ) {
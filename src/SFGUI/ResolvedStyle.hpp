@@ -0,0 +1,32 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+#include <SFGUI/PropertyValue.hpp>
+#include <SFGUI/AncestorFilter.hpp>
+
+#include <map>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace sfg {
+namespace priv {
+
+/** Property values the engine already looked up for a widget.
+ * Children with the same name, ID, class and state whose parents share a
+ * style match the same selectors, so they share their style as well.
+ */
+struct ResolvedStyle {
+	typedef std::tuple<unsigned int, std::string, std::string, int> ChildKey; //!< Name atom ID, ID, class and state.
+
+	std::vector<const PropertyValue*> values; //!< Indexed by property index.
+	AncestorFilter ancestors; //!< Names, IDs and classes of the widget's ancestors.
+	std::map<ChildKey, std::weak_ptr<ResolvedStyle>> children; //!< Styles shared by the children of widgets using this style.
+	std::size_t children_limit; //!< Size at which expired children are removed.
+	unsigned int generation; //!< Style generation of the engine the values were looked up in.
+};
+
+}
+}
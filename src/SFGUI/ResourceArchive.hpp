@@ -0,0 +1,74 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <cstdint>
+#include <cstddef>
+
+namespace sfg {
+namespace priv {
+
+/** Layout of resource archives as read by ArchiveResourceLoader.
+ *
+ * All numbers are 32 bit little endian. The file starts with a header:
+ *   magic "SFGA", version, entry count, reserved
+ * It is followed by the entry table, sorted by name:
+ *   name offset, name length, data offset, data size, type, width, height, reserved
+ * Names and data are stored behind the table. Offsets are relative to the
+ * start of the file and data is aligned to alignment bytes.
+ */
+namespace archive {
+
+const char magic[4] = { 'S', 'F', 'G', 'A' };
+const std::uint32_t version = 1;
+
+const std::size_t header_size = 16;
+const std::size_t entry_size = 32;
+const std::size_t alignment = 16;
+
+/** Entry types.
+ */
+enum EntryType : std::uint32_t {
+	RAW = 0, //!< File contents, e.g. a font or an encoded image.
+	RGBA = 1 //!< Decoded image, width * height * 4 bytes.
+};
+
+/** Entry fields, in units of 32 bit numbers.
+ */
+enum EntryField : std::size_t {
+	NAME_OFFSET = 0,
+	NAME_LENGTH,
+	DATA_OFFSET,
+	DATA_SIZE,
+	TYPE,
+	WIDTH,
+	HEIGHT
+};
+
+/** Read a little endian number.
+ * @param data Start of the number.
+ * @return Number.
+ */
+inline std::uint32_t Read( const char* data ) {
+	auto bytes = reinterpret_cast<const unsigned char*>( data );
+
+	return static_cast<std::uint32_t>( bytes[0] ) |
+	       static_cast<std::uint32_t>( bytes[1] ) << 8 |
+	       static_cast<std::uint32_t>( bytes[2] ) << 16 |
+	       static_cast<std::uint32_t>( bytes[3] ) << 24;
+}
+
+/** Write a little endian number.
+ * @param data Destination.
+ * @param value Number.
+ */
+inline void Write( char* data, std::uint32_t value ) {
+	for( std::size_t index = 0; index < 4; ++index ) {
+		data[index] = static_cast<char>( ( value >> ( index * 8 ) ) & 0xff );
+	}
+}
+
+}
+
+}
+}
@@ -1,19 +1,49 @@
 #include <SFGUI/ResourceManager.hpp>
 #include <SFGUI/FileResourceLoader.hpp>
+#include <SFGUI/MappedResourceLoader.hpp>
 
 #if defined( SFGUI_INCLUDE_FONT )
 #include <SFGUI/DejaVuSansFont.hpp>
 #endif
 
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+
+namespace {
+
+// Loads are mostly waiting for the disk and decoding, a few threads suffice.
+const unsigned int max_worker_count = 4;
+
+}
 
 namespace sfg {
 
 ResourceManager::ResourceManager( bool use_default_font ) :
+	m_image_released( std::make_shared<std::atomic<bool>>( false ) ),
+	m_statistics(),
+	m_image_budget( 0 ),
+	m_stop_workers( false ),
 	m_use_default_font( use_default_font )
 {
 	// Add file resource loader as fallback.
 	CreateLoader<FileResourceLoader>();
+	CreateLoader<MappedResourceLoader>();
+}
+
+ResourceManager::~ResourceManager() {
+	{
+		std::lock_guard<std::mutex> lock( m_jobs_mutex );
+
+		m_jobs.clear();
+		m_stop_workers = true;
+	}
+
+	m_jobs_condition.notify_all();
+
+	for( auto& worker : m_workers ) {
+		worker.join();
+	}
 }
 
 std::shared_ptr<const ResourceLoader> ResourceManager::GetLoader( const std::string& id ) {
@@ -21,15 +51,26 @@ std::shared_ptr<const ResourceLoader> ResourceManager::GetLoader( const std::str
 	return loader_iter == m_loaders.end() ? std::shared_ptr<const ResourceLoader>() : loader_iter->second;
 }
 
+void ResourceManager::AddLoader( std::shared_ptr<const ResourceLoader> loader ) {
+	m_loaders[loader->GetIdentifier()] = loader;
+}
+
 std::shared_ptr<const sf::Font> ResourceManager::GetFont( const std::string& path ) {
-	{
-		auto font_iter = m_fonts.find( path );
+	auto font_iter = m_fonts.find( path );
 
-		if( font_iter != m_fonts.end() ) {
-			return font_iter->second;
-		}
+	if( font_iter != m_fonts.end() ) {
+		++m_statistics.font_hits;
+		return font_iter->second;
 	}
 
+	++m_statistics.font_misses;
+
+	return LoadFont( path );
+}
+
+std::shared_ptr<const sf::Font> ResourceManager::LoadFont( const std::string& path ) {
+	// Requests are counted by the caller, falling back
+	// to the default font doesn't count as another one.
 	if( path == "Default" ) {
 		if( m_use_default_font ) {
 #if defined( SFGUI_INCLUDE_FONT )
@@ -52,7 +93,7 @@ std::shared_ptr<const sf::Font> ResourceManager::GetFont( const std::string& pat
 	auto loader = GetMatchingLoader( path );
 
 	if( !loader ) {
-		auto font = GetFont( "Default" );
+		auto font = GetDefaultFont();
 #if defined( SFGUI_DEBUG )
 		std::cerr << "SFGUI warning: Couldn't find a loader for the font \"" << path << "\".\n";
 #endif
@@ -63,7 +104,7 @@ std::shared_ptr<const sf::Font> ResourceManager::GetFont( const std::string& pat
 	auto font = loader->LoadFont( GetFilename( path, *loader ) );
 
 	if( !font ) {
-		font = GetFont( "Default" );
+		font = GetDefaultFont();
 #if defined( SFGUI_DEBUG )
 		std::cerr << "SFGUI warning: Couldn't load the font \"" << path << "\".\n";
 #endif
@@ -76,13 +117,26 @@ std::shared_ptr<const sf::Font> ResourceManager::GetFont( const std::string& pat
 	return font;
 }
 
+std::shared_ptr<const sf::Font> ResourceManager::GetDefaultFont() {
+	auto font_iter = m_fonts.find( "Default" );
+
+	if( font_iter != m_fonts.end() ) {
+		return font_iter->second;
+	}
+
+	return LoadFont( "Default" );
+}
+
 std::shared_ptr<const sf::Image> ResourceManager::GetImage( const std::string& path ) {
 	auto image_iter = m_images.find( path );
 
 	if( image_iter != m_images.end() ) {
-		return image_iter->second;
+		++m_statistics.image_hits;
+		return UseImage( image_iter->second );
 	}
 
+	++m_statistics.image_misses;
+
 	// Try to load.
 	auto loader = GetMatchingLoader( path );
 
@@ -97,8 +151,193 @@ std::shared_ptr<const sf::Image> ResourceManager::GetImage( const std::string& p
 	}
 
 	// Cache.
-	m_images[path] = image;
-	return image;
+	return UseImage( CacheImage( path, image ) );
+}
+
+void ResourceManager::GetFontAsync( const std::string& path, FontCallback callback ) {
+	auto font_iter = m_fonts.find( path );
+
+	if( font_iter != m_fonts.end() ) {
+		++m_statistics.font_hits;
+		callback( font_iter->second );
+		return;
+	}
+
+	++m_statistics.font_misses;
+
+	auto loader = GetMatchingLoader( path );
+
+	// Nothing to load, just fall back like GetFont() does.
+	if( !loader ) {
+		callback( LoadFont( path ) );
+		return;
+	}
+
+	auto& callbacks = m_font_callbacks[path];
+	callbacks.push_back( std::move( callback ) );
+
+	// Already being loaded.
+	if( callbacks.size() > 1 ) {
+		return;
+	}
+
+	auto filename = GetFilename( path, *loader );
+
+	PushJob( [this, loader, path, filename]() {
+		auto font = loader->LoadFont( filename );
+
+		std::lock_guard<std::mutex> lock( m_jobs_mutex );
+
+		m_finished_jobs.emplace_back( [this, path, font]() {
+			FinishFont( path, font );
+		} );
+	} );
+}
+
+void ResourceManager::GetImageAsync( const std::string& path, ImageCallback callback ) {
+	auto image_iter = m_images.find( path );
+
+	if( image_iter != m_images.end() ) {
+		++m_statistics.image_hits;
+		callback( UseImage( image_iter->second ) );
+		return;
+	}
+
+	++m_statistics.image_misses;
+
+	auto loader = GetMatchingLoader( path );
+
+	if( !loader ) {
+		callback( std::shared_ptr<const sf::Image>() );
+		return;
+	}
+
+	auto& callbacks = m_image_callbacks[path];
+	callbacks.push_back( std::move( callback ) );
+
+	// Already being loaded.
+	if( callbacks.size() > 1 ) {
+		return;
+	}
+
+	auto filename = GetFilename( path, *loader );
+
+	PushJob( [this, loader, path, filename]() {
+		auto image = loader->LoadImage( filename );
+
+		std::lock_guard<std::mutex> lock( m_jobs_mutex );
+
+		m_finished_jobs.emplace_back( [this, path, image]() {
+			FinishImage( path, image );
+		} );
+	} );
+}
+
+std::size_t ResourceManager::Update() {
+	std::vector<Job> finished_jobs;
+
+	{
+		std::lock_guard<std::mutex> lock( m_jobs_mutex );
+		finished_jobs.swap( m_finished_jobs );
+	}
+
+	for( const auto& job : finished_jobs ) {
+		job();
+	}
+
+	// Images that were still in use when the budget was
+	// exceeded might not be anymore.
+	if( m_image_released->exchange( false ) ) {
+		EvictImages();
+	}
+
+	return finished_jobs.size();
+}
+
+void ResourceManager::PushJob( Job job ) {
+	{
+		std::lock_guard<std::mutex> lock( m_jobs_mutex );
+		m_jobs.push_back( std::move( job ) );
+	}
+
+	m_jobs_condition.notify_one();
+
+	// Workers are only started once something is loaded asynchronously.
+	auto worker_count = std::min( std::max( std::thread::hardware_concurrency(), 1u ), max_worker_count );
+
+	if( m_workers.size() < worker_count ) {
+		m_workers.emplace_back( &ResourceManager::RunWorker, this );
+	}
+}
+
+void ResourceManager::RunWorker() {
+	while( true ) {
+		Job job;
+
+		{
+			std::unique_lock<std::mutex> lock( m_jobs_mutex );
+
+			m_jobs_condition.wait( lock, [this]() {
+				return m_stop_workers || !m_jobs.empty();
+			} );
+
+			if( m_stop_workers ) {
+				return;
+			}
+
+			job = std::move( m_jobs.front() );
+			m_jobs.pop_front();
+		}
+
+		job();
+	}
+}
+
+void ResourceManager::FinishFont( const std::string& path, std::shared_ptr<const sf::Font> font ) {
+	auto font_iter = m_fonts.find( path );
+
+	// The font might have been loaded or added synchronously in the meantime.
+	if( font_iter != m_fonts.end() ) {
+		font = font_iter->second;
+	}
+	else {
+		if( !font ) {
+			font = GetDefaultFont();
+#if defined( SFGUI_DEBUG )
+			std::cerr << "SFGUI warning: Couldn't load the font \"" << path << "\".\n";
+#endif
+		}
+
+		m_fonts[path] = font;
+	}
+
+	// Callbacks may request the same font again, so take them out first.
+	auto callbacks = std::move( m_font_callbacks[path] );
+	m_font_callbacks.erase( path );
+
+	for( const auto& callback : callbacks ) {
+		callback( font );
+	}
+}
+
+void ResourceManager::FinishImage( const std::string& path, std::shared_ptr<const sf::Image> image ) {
+	auto image_iter = m_images.find( path );
+
+	// The image might have been loaded or added synchronously in the meantime.
+	if( image_iter != m_images.end() ) {
+		image = UseImage( image_iter->second );
+	}
+	else if( image ) {
+		image = UseImage( CacheImage( path, image ) );
+	}
+
+	// Callbacks may request the same image again, so take them out first.
+	auto callbacks = std::move( m_image_callbacks[path] );
+	m_image_callbacks.erase( path );
+
+	for( const auto& callback : callbacks ) {
+		callback( image );
+	}
 }
 
 std::shared_ptr<const ResourceLoader> ResourceManager::GetMatchingLoader( const std::string& path ) {
@@ -132,6 +371,9 @@ void ResourceManager::Clear() {
 	m_loaders.clear();
 	m_fonts.clear();
 	m_images.clear();
+	m_image_uses.clear();
+
+	m_statistics.image_bytes = 0;
 }
 
 std::string ResourceManager::GetFilename( const std::string& path, const ResourceLoader& loader ) {
@@ -150,11 +392,117 @@ void ResourceManager::AddFont( const std::string& path, std::shared_ptr<const sf
 }
 
 void ResourceManager::AddImage( const std::string& path, std::shared_ptr<const sf::Image> image ) {
-	m_images[path] = image;
+	CacheImage( path, image );
+
+	// The caller might not keep the image, check again during Update().
+	m_image_released->store( true );
 }
 
 void ResourceManager::SetDefaultFont( std::shared_ptr<const sf::Font> font ) {
 	AddFont( "Default", font );
 }
 
+void ResourceManager::SetImageBudget( std::size_t bytes ) {
+	m_image_budget = bytes;
+
+	EvictImages();
+}
+
+std::size_t ResourceManager::GetImageBudget() const {
+	return m_image_budget;
+}
+
+const ResourceManager::Statistics& ResourceManager::GetStatistics() const {
+	return m_statistics;
+}
+
+void ResourceManager::ResetStatistics() {
+	auto image_bytes = m_statistics.image_bytes;
+
+	m_statistics = Statistics();
+	m_statistics.image_bytes = image_bytes;
+}
+
+std::shared_ptr<const sf::Image> ResourceManager::UseImage( ImageEntry& entry ) {
+	m_image_uses.splice( m_image_uses.begin(), m_image_uses, entry.use );
+
+	if( !entry.image ) {
+		return entry.image;
+	}
+
+	auto image = entry.handed_out.lock();
+
+	// Everyone gets the same pointer. Once all of them let go, it lets us
+	// know that the image might be evicted now.
+	if( !image ) {
+		auto cached_image = entry.image;
+		auto released = m_image_released;
+
+		// The deleter outlives the call as long as handed_out does,
+		// so it has to let go of the image by itself.
+		image = std::shared_ptr<const sf::Image>( cached_image.get(), [cached_image, released]( const sf::Image* ) mutable {
+			cached_image.reset();
+			released->store( true );
+		} );
+
+		entry.handed_out = image;
+	}
+
+	return image;
+}
+
+ResourceManager::ImageEntry& ResourceManager::CacheImage( const std::string& path, std::shared_ptr<const sf::Image> image ) {
+	auto iter = m_images.find( path );
+
+	if( iter == m_images.end() ) {
+		iter = m_images.insert( std::make_pair( path, ImageEntry() ) ).first;
+		iter->second.bytes = 0;
+		iter->second.use = m_image_uses.insert( m_image_uses.begin(), &iter->first );
+	}
+	else {
+		m_image_uses.splice( m_image_uses.begin(), m_image_uses, iter->second.use );
+	}
+
+	auto& entry = iter->second;
+
+	m_statistics.image_bytes -= entry.bytes;
+
+	entry.image = image;
+	entry.handed_out.reset();
+	entry.bytes = image ? static_cast<std::size_t>( image->getSize().x ) * image->getSize().y * 4 : 0;
+
+	m_statistics.image_bytes += entry.bytes;
+
+	// The caller still holds image, so the entry itself stays.
+	EvictImages();
+
+	return entry;
+}
+
+void ResourceManager::EvictImages() {
+	if( !m_image_budget ) {
+		return;
+	}
+
+	// Walk from the least recently used image towards the most recently used one.
+	auto use = m_image_uses.end();
+
+	while( ( m_statistics.image_bytes > m_image_budget ) && ( use != m_image_uses.begin() ) ) {
+		--use;
+
+		auto iter = m_images.find( **use );
+
+		// Images are only dropped if nobody else holds on to them.
+		if( iter->second.image.use_count() > 1 ) {
+			continue;
+		}
+
+		m_statistics.image_bytes -= iter->second.bytes;
+		++m_statistics.image_evictions;
+
+		use = m_image_uses.erase( use );
+		m_images.erase( iter );
+	}
+}
+
 }
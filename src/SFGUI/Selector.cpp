@@ -2,6 +2,12 @@
 #include <SFGUI/Container.hpp>
 #include <SFGUI/Widget.hpp>
 
+namespace {
+
+const sfg::Atom wildcard( "*" );
+
+}
+
 namespace sfg {
 
 Selector::Selector() :
@@ -50,7 +56,7 @@ Selector& Selector::operator=( const Selector& other ) {
 Selector::Ptr Selector::Create( const std::string& widget, const std::string& id, const std::string& class_, const std::string& state, HierarchyType hierarchy, Ptr parent ) {
 	Ptr selector( new Selector );
 
-	selector->m_widget = widget;
+	selector->m_widget = Atom( widget );
 	selector->m_id = id;
 	selector->m_class = class_;
 
@@ -88,6 +94,10 @@ Selector::Ptr Selector::Create( const std::string& widget, const std::string& id
 }
 
 const std::string& Selector::GetWidgetName() const {
+	return m_widget.GetString();
+}
+
+const Atom& Selector::GetWidgetNameAtom() const {
 	return m_widget;
 }
 
@@ -126,12 +136,12 @@ std::string Selector::BuildString() const {
 	}
 
 	// Append own string.
-	if( m_widget.empty() ) {
+	if( m_widget == Atom() ) {
 		// Use a wildcard for all widgets.
 		str += "*";
 	}
 	else {
-		str += m_widget;
+		str += m_widget.GetString();
 	}
 
 	if( !m_id.empty() ) {
@@ -190,8 +200,8 @@ bool Selector::Matches( Widget::PtrConst widget ) const {
 	// Recursion is your friend ;)
 
 	// Check if current stage is a pass...
-	if( ( !m_widget.compare("*") && m_id.empty() && m_class.empty() && !m_state ) || // Wildcard
-		 ( ( m_widget.empty() || !m_widget.compare("*") || m_widget == widget->GetName() ) && //
+	if( ( ( m_widget == wildcard ) && m_id.empty() && m_class.empty() && !m_state ) || // Wildcard
+		 ( ( ( m_widget == Atom() ) || ( m_widget == wildcard ) || ( m_widget == widget->GetNameAtom() ) ) && //
 		 ( m_id.empty() || m_id == widget->GetId() ) && // Selector and widget match
 		 ( m_class.empty() || m_class  == widget->GetClass() ) && //
 		 ( !m_state || *m_state == widget->GetState() ) ) ) { //
@@ -228,7 +238,7 @@ bool Selector::Matches( Widget::PtrConst widget ) const {
 int Selector::GetScore() const {
 	int score = 0;
 
-	score += ( ( GetWidgetName().empty() || ( GetWidgetName() == "*" ) ) ? 0 : 1 );
+	score += ( ( ( m_widget == Atom() ) || ( m_widget == wildcard ) ) ? 0 : 1 );
 	score += ( ( !GetState() ) ? 0 : 1 );
 	score += ( GetClass().empty() ? 0 : 100 );
 	score += ( GetId().empty() ? 0 : 10000 );
@@ -1,14 +1,32 @@
 #include <SFGUI/Signal.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+
 namespace {
 
-unsigned int serial = 1;
-sfg::Signal::SignalID last_guid = 0;
+// Atomic so IDs stay unique, connecting still isn't thread-safe.
+// Other threads have to go through Desktop::Post().
+std::atomic<unsigned int> serial( 1 );
+std::atomic<sfg::Signal::SignalID> last_guid( 0 );
 
 }
 
 namespace sfg {
 
+Signal::Delegate::Delegate( unsigned int serial_, std::function<void()> function_ ) :
+	serial( serial_ ),
+	function( std::move( function_ ) )
+{
+}
+
+Signal::Delegates::Delegates() :
+	emitting( 0 ),
+	has_tombstones( false )
+{
+}
+
 Signal::Signal( Signal&& other ) :
 	m_delegates( std::move( other.m_delegates ) )
 {
@@ -21,11 +39,17 @@ Signal& Signal::operator=( Signal&& other ) {
 
 unsigned int Signal::Connect( std::function<void()> delegate ) {
 	if( !m_delegates ) {
-		m_delegates.reset( new DelegateMap );
+		m_delegates.reset( new Delegates );
 	}
 
-	(*m_delegates)[serial] = delegate;
-	return serial++;
+	// Adding to the active list while emitting could relocate
+	// the delegate that is currently running.
+	auto& list = m_delegates->emitting ? m_delegates->pending : m_delegates->active;
+	auto connection_serial = serial++;
+
+	list.emplace_back( connection_serial, std::move( delegate ) );
+
+	return connection_serial;
 }
 
 void Signal::operator()() const {
@@ -33,9 +57,25 @@ void Signal::operator()() const {
 		return;
 	}
 
-	for( const auto& delegate : *m_delegates ) {
-		delegate.second();
+	auto& delegates = *m_delegates;
+
+	++delegates.emitting;
+
+	try {
+		for( const auto& delegate : delegates.active ) {
+			if( delegate.serial ) {
+				delegate.function();
+			}
+		}
 	}
+	catch( ... ) {
+		--delegates.emitting;
+		Flush( delegates );
+		throw;
+	}
+
+	--delegates.emitting;
+	Flush( delegates );
 }
 
 void Signal::Disconnect( unsigned int serial ) {
@@ -43,46 +83,85 @@ void Signal::Disconnect( unsigned int serial ) {
 		return;
 	}
 
-	m_delegates->erase( serial );
+	auto has_serial = [serial]( const Delegate& delegate ) {
+		return delegate.serial == serial;
+	};
+
+	auto& active = m_delegates->active;
+	auto& pending = m_delegates->pending;
+
+	auto iter = std::find_if( active.begin(), active.end(), has_serial );
+
+	if( iter != active.end() ) {
+		if( m_delegates->emitting ) {
+			// The delegate might be running right now, just
+			// mark it and remove it once emission is done.
+			iter->serial = 0;
+			m_delegates->has_tombstones = true;
+		}
+		else {
+			active.erase( iter );
+		}
+	}
+	else {
+		pending.erase( std::remove_if( pending.begin(), pending.end(), has_serial ), pending.end() );
+	}
 
-	if( m_delegates->empty() ) {
+	if( !m_delegates->emitting && active.empty() && pending.empty() ) {
 		m_delegates.reset();
 	}
 }
 
+void Signal::Flush( Delegates& delegates ) {
+	if( delegates.emitting ) {
+		return;
+	}
+
+	if( delegates.has_tombstones ) {
+		delegates.active.erase(
+			std::remove_if( delegates.active.begin(), delegates.active.end(), []( const Delegate& delegate ) {
+				return !delegate.serial;
+			} ),
+			delegates.active.end()
+		);
+
+		delegates.has_tombstones = false;
+	}
+
+	if( !delegates.pending.empty() ) {
+		std::move( delegates.pending.begin(), delegates.pending.end(), std::back_inserter( delegates.active ) );
+		delegates.pending.clear();
+	}
+}
+
 Signal::SignalID Signal::GetGUID() {
 	return ++last_guid;
 }
 
 Signal& SignalContainer::operator[]( const Signal::SignalID& id ) {
-	if( !m_signals ) {
-		m_signals.reset( new SignalMap );
+	// Widgets only have a handful of connected signals,
+	// a linear search beats any kind of map.
+	for( auto& signal : m_signals ) {
+		if( signal.first == id ) {
+			return signal.second;
+		}
 	}
 
-	// Find signal in the map.
-	auto signal_iter = m_signals->find( id );
+	m_signals.emplace_back( id, Signal() );
 
-	if( signal_iter == m_signals->end() ) {
-		// Requested signal is not present in map.
-		// Insert a new signal and set the iterator to point to it.
-		signal_iter = m_signals->insert(
-			std::pair<Signal::SignalID, Signal>( id, Signal() )
-		).first;
-	}
-
-	// Return the signal.
-	return signal_iter->second;
+	return m_signals.back().second;
 }
 
 void SignalContainer::Emit( const Signal::SignalID& id ) {
-	if( !m_signals || !id ) {
+	if( !id ) {
 		return;
 	}
 
-	auto signal_iter = m_signals->find( id );
-
-	if( signal_iter != m_signals->end() ) {
-		signal_iter->second();
+	for( const auto& signal : m_signals ) {
+		if( signal.first == id ) {
+			signal.second();
+			return;
+		}
 	}
 }
 
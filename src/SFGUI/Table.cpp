@@ -4,10 +4,18 @@
 #include <SFGUI/Context.hpp>
 #include <SFGUI/Engine.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <cassert>
 
 namespace sfg {
 
+Table::Table() :
+	m_requisitions_invalid( true ),
+	m_allocations_invalid( true )
+{
+}
+
 Table::Ptr Table::Create() {
 	return Ptr( new Table );
 }
@@ -34,9 +42,14 @@ void Table::Attach( Widget::Ptr widget, const sf::Rect<sf::Uint32>& rect, int x_
 	assert( rect.width > 0 );
 	assert( rect.height > 0 );
 
+	if( m_cell_map.find( widget.get() ) != m_cell_map.end() ) {
+		return;
+	}
+
 	// Store widget in a table cell object.
 	priv::TableCell cell( widget, rect, x_options, y_options, padding );
 	m_cells.push_back( cell );
+	m_cell_map[widget.get()] = std::prev( m_cells.end() );
 
 	// Check if we need to enlarge rows/columns.
 	if( rect.left + rect.width >= m_columns.size() ) {
@@ -46,6 +59,12 @@ void Table::Attach( Widget::Ptr widget, const sf::Rect<sf::Uint32>& rect, int x_
 		// Set default spacings.
 		for( std::size_t col_index = old_size; col_index < m_columns.size(); ++col_index ) {
 			m_columns[col_index].spacing = m_general_spacings.x;
+			InvalidateColumn( col_index );
+		}
+
+		// The previously last column now has to account for its spacing.
+		if( old_size > 0 ) {
+			InvalidateColumn( old_size - 1 );
 		}
 	}
 
@@ -56,9 +75,28 @@ void Table::Attach( Widget::Ptr widget, const sf::Rect<sf::Uint32>& rect, int x_
 		// Set default spacings.
 		for( std::size_t row_index = old_size; row_index < m_rows.size(); ++row_index ) {
 			m_rows[row_index].spacing = m_general_spacings.y;
+			InvalidateRow( row_index );
 		}
+
+		// The previously last row now has to account for its spacing.
+		if( old_size > 0 ) {
+			InvalidateRow( old_size - 1 );
+		}
+	}
+
+	// Register the cell with the columns and rows it spans.
+	auto& stored_cell = m_cells.back();
+
+	for( auto col_idx = rect.left; col_idx < rect.left + rect.width; ++col_idx ) {
+		m_columns[col_idx].cells.push_back( &stored_cell );
+	}
+
+	for( auto row_idx = rect.top; row_idx < rect.top + rect.height; ++row_idx ) {
+		m_rows[row_idx].cells.push_back( &stored_cell );
 	}
 
+	InvalidateCell( stored_cell );
+
 	// Add widget to container.
 	Add( widget );
 
@@ -72,74 +110,113 @@ void Table::HandleSizeChange() {
 }
 
 void Table::UpdateRequisitions() {
-	// Reset requisitions and expand flags, at first.
-	for( auto& column : m_columns ) {
-		column.requisition = 0.f;
-		column.allocation = 0.f;
-		column.expand = false;
+	if( m_requisitions_invalid ) {
+		for( std::size_t col_idx = 0; col_idx < m_columns.size(); ++col_idx ) {
+			UpdateColumnRequisition( col_idx );
+		}
+
+		for( std::size_t row_idx = 0; row_idx < m_rows.size(); ++row_idx ) {
+			UpdateRowRequisition( row_idx );
+		}
+
+		m_requisitions_invalid = false;
 	}
+	else {
+		// Only recalculate the columns and rows spanned by changed cells.
+		for( const auto col_idx : m_dirty_columns ) {
+			UpdateColumnRequisition( col_idx );
+		}
 
-	for( auto& row : m_rows ) {
-		row.requisition = 0.f;
-		row.allocation = 0.f;
-		row.expand = false;
+		for( const auto row_idx : m_dirty_rows ) {
+			UpdateRowRequisition( row_idx );
+		}
 	}
 
-	// Iterate over children and add requisitions to columns and rows.
-	for( const auto& cell : m_cells ) {
-		auto col_requisition = cell.child->GetRequisition().x / static_cast<float>( cell.rect.width ) + 2 * cell.padding.x;
-		auto col_bound = cell.rect.left + cell.rect.width;
+	m_dirty_columns.clear();
+	m_dirty_rows.clear();
+}
 
-		for( sf::Uint32 col_idx = cell.rect.left; col_idx < col_bound; ++col_idx ) {
-			m_columns[col_idx].requisition = std::max(
-				m_columns[col_idx].requisition,
-				col_requisition + (col_idx + 1 < m_columns.size() ? m_columns[col_idx].spacing : 0) // Add spacing if not last column.
-			);
+void Table::UpdateColumnRequisition( std::size_t index ) {
+	auto& column = m_columns[index];
 
-			// Set expand flag.
-			if( (cell.x_options & EXPAND) == EXPAND ) {
-				m_columns[col_idx].expand = true;
-			}
-		}
+	column.requisition = 0.f;
+	column.expand = false;
+	column.dirty = false;
 
-		auto row_requisition = cell.child->GetRequisition().y / static_cast<float>( cell.rect.height ) + 2 * cell.padding.y;
-		auto row_bound = cell.rect.top + cell.rect.height;
+	// Add spacing if not last column.
+	auto spacing = ( index + 1 < m_columns.size() ? column.spacing : 0.f );
 
-		for( sf::Uint32 row_idx = cell.rect.top; row_idx < row_bound; ++row_idx ) {
-			m_rows[row_idx].requisition = std::max(
-				m_rows[row_idx].requisition,
-				row_requisition + (row_idx + 1 < m_rows.size() ? m_rows[row_idx].spacing : 0) // Add spacing if not last row.
-			);
+	for( const auto& cell : column.cells ) {
+		column.requisition = std::max(
+			column.requisition,
+			cell->child->GetRequisition().x / static_cast<float>( cell->rect.width ) + 2 * cell->padding.x + spacing
+		);
 
-			// Set expand flag.
-			if( (cell.y_options & EXPAND) == EXPAND ) {
-				m_rows[row_idx].expand = true;
-			}
+		// Set expand flag.
+		if( (cell->x_options & EXPAND) == EXPAND ) {
+			column.expand = true;
 		}
 	}
+}
 
-	AllocateChildren();
+void Table::UpdateRowRequisition( std::size_t index ) {
+	auto& row = m_rows[index];
+
+	row.requisition = 0.f;
+	row.expand = false;
+	row.dirty = false;
+
+	// Add spacing if not last row.
+	auto spacing = ( index + 1 < m_rows.size() ? row.spacing : 0.f );
+
+	for( const auto& cell : row.cells ) {
+		row.requisition = std::max(
+			row.requisition,
+			cell->child->GetRequisition().y / static_cast<float>( cell->rect.height ) + 2 * cell->padding.y + spacing
+		);
+
+		// Set expand flag.
+		if( (cell->y_options & EXPAND) == EXPAND ) {
+			row.expand = true;
+		}
+	}
 }
 
 void Table::AllocateChildren() {
+	UpdateRequisitions();
+
 	auto gap = Context::Get().GetEngine().GetProperty<float>(
 		"Gap",
 		shared_from_this()
 	);
 
+	// Cells that have to be reallocated. Cells whose requisition changed are
+	// always reallocated, others only if their columns or rows moved or
+	// changed size.
+	TableCellPtrArray cells;
+	cells.swap( m_dirty_cells );
+
+	auto queue_cells = [&cells]( const TableCellPtrArray& option_cells ) {
+		for( const auto& cell : option_cells ) {
+			if( !cell->pending_allocation ) {
+				cell->pending_allocation = true;
+				cells.push_back( cell );
+			}
+		}
+	};
+
 	// Calculate column allocations.
 	auto total_width = GetAllocation().width - 2 * gap;
 	std::size_t num_expand = 0;
 
-	// First step is counting number of expandable columns and setting allocation
-	// to requisition.
-	for( auto& column : m_columns ) {
+	// First step is counting number of expandable columns and subtracting
+	// requisitions from the available width.
+	for( const auto& column : m_columns ) {
 		if( column.expand ) {
 			++num_expand;
 		}
 
-		column.allocation = column.requisition;
-		total_width -= column.allocation;
+		total_width -= column.requisition;
 	}
 
 	// Next step is distribution of remaining width (i.e. extra width given by
@@ -149,15 +226,14 @@ void Table::AllocateChildren() {
 	for( std::size_t col_idx = 0; col_idx < m_columns.size(); ++col_idx ) {
 		auto& col = m_columns[col_idx];
 
-		if( col.expand ) {
-			col.allocation += extra_width;
-		}
+		auto allocation = col.requisition + ( col.expand ? extra_width : 0.f );
+		auto position = ( col_idx == 0 ? 0.f : m_columns[col_idx - 1].position + m_columns[col_idx - 1].allocation );
 
-		if( col_idx == 0 ) {
-			col.position = 0;
-		}
-		else {
-			col.position = m_columns[col_idx - 1].position + m_columns[col_idx - 1].allocation;
+		if( m_allocations_invalid || ( allocation != col.allocation ) || ( position != col.position ) ) {
+			col.allocation = allocation;
+			col.position = position;
+
+			queue_cells( col.cells );
 		}
 	}
 
@@ -165,15 +241,14 @@ void Table::AllocateChildren() {
 	auto total_height = 2 * gap + GetAllocation().height;
 	num_expand = 0;
 
-	// First step is counting number of expandable rows and setting allocation
-	// to requisition.
-	for( auto& row : m_rows ) {
+	// First step is counting number of expandable rows and subtracting
+	// requisitions from the available height.
+	for( const auto& row : m_rows ) {
 		if( row.expand ) {
 			++num_expand;
 		}
 
-		row.allocation = row.requisition;
-		total_height -= row.allocation;
+		total_height -= row.requisition;
 	}
 
 	// Next step is distribution of remaining height (i.e. extra height given by
@@ -183,62 +258,105 @@ void Table::AllocateChildren() {
 	for( std::size_t row_idx = 0; row_idx < m_rows.size(); ++row_idx ) {
 		auto& row = m_rows[row_idx];
 
-		if( row.expand ) {
-			row.allocation += extra_height;
-		}
+		auto allocation = row.requisition + ( row.expand ? extra_height : 0.f );
+		auto position = ( row_idx == 0 ? 0.f : m_rows[row_idx - 1].position + m_rows[row_idx - 1].allocation );
 
-		if( row_idx == 0 ) {
-			row.position = 0;
-		}
-		else {
-			row.position = m_rows[row_idx - 1].position + m_rows[row_idx - 1].allocation;
+		if( m_allocations_invalid || ( allocation != row.allocation ) || ( position != row.position ) ) {
+			row.allocation = allocation;
+			row.position = position;
+
+			queue_cells( row.cells );
 		}
 	}
 
+	m_allocations_invalid = false;
+
 	// Last step: Allocate children.
-	std::size_t bound = 0;
-
-	for( const auto& cell : m_cells ) {
-		sf::FloatRect allocation(
-			m_columns[cell.rect.left].position,
-			m_rows[cell.rect.top].position,
-			0,
-			0
-		);
+	for( const auto& cell : cells ) {
+		cell->pending_allocation = false;
 
-		bound = cell.rect.left + cell.rect.width;
+		AllocateCell( *cell );
+	}
+}
 
-		for( std::size_t col_idx = cell.rect.left; col_idx < bound; ++col_idx ) {
-			allocation.width += m_columns[col_idx].allocation;
+void Table::AllocateCell( const priv::TableCell& cell ) const {
+	sf::FloatRect allocation(
+		m_columns[cell.rect.left].position,
+		m_rows[cell.rect.top].position,
+		0,
+		0
+	);
 
-			if( col_idx + 1 == bound && col_idx + 1 < m_columns.size() ) {
-				allocation.width -= m_columns[col_idx].spacing;
-			}
+	std::size_t bound = cell.rect.left + cell.rect.width;
+
+	for( std::size_t col_idx = cell.rect.left; col_idx < bound; ++col_idx ) {
+		allocation.width += m_columns[col_idx].allocation;
+
+		if( col_idx + 1 == bound && col_idx + 1 < m_columns.size() ) {
+			allocation.width -= m_columns[col_idx].spacing;
 		}
+	}
 
-		bound = cell.rect.top + cell.rect.height;
+	bound = cell.rect.top + cell.rect.height;
 
-		for( std::size_t row_idx = cell.rect.top; row_idx < bound; ++row_idx ) {
-			allocation.height += m_rows[row_idx].allocation;
+	for( std::size_t row_idx = cell.rect.top; row_idx < bound; ++row_idx ) {
+		allocation.height += m_rows[row_idx].allocation;
 
-			if( row_idx + 1 == bound && row_idx + 1 < m_rows.size() ) {
-				allocation.height -= m_rows[row_idx].spacing;
-			}
+		if( row_idx + 1 == bound && row_idx + 1 < m_rows.size() ) {
+			allocation.height -= m_rows[row_idx].spacing;
 		}
+	}
 
-		// Limit size if FILL is not set.
-		if( (cell.x_options & FILL) != FILL ) {
-			allocation.width = std::min( allocation.width, cell.child->GetRequisition().x );
-		}
+	// Limit size if FILL is not set.
+	if( (cell.x_options & FILL) != FILL ) {
+		allocation.width = std::min( allocation.width, cell.child->GetRequisition().x );
+	}
 
-		if( (cell.y_options & FILL) != FILL ) {
-			allocation.height = std::min( allocation.height, cell.child->GetRequisition().y );
-		}
+	if( (cell.y_options & FILL) != FILL ) {
+		allocation.height = std::min( allocation.height, cell.child->GetRequisition().y );
+	}
+
+	cell.child->SetAllocation( allocation );
+}
+
+void Table::InvalidateColumn( std::size_t index ) {
+	if( m_columns[index].dirty ) {
+		return;
+	}
+
+	m_columns[index].dirty = true;
+	m_dirty_columns.push_back( index );
+}
+
+void Table::InvalidateRow( std::size_t index ) {
+	if( m_rows[index].dirty ) {
+		return;
+	}
+
+	m_rows[index].dirty = true;
+	m_dirty_rows.push_back( index );
+}
+
+void Table::InvalidateCell( priv::TableCell& cell ) {
+	for( auto col_idx = cell.rect.left; col_idx < cell.rect.left + cell.rect.width; ++col_idx ) {
+		InvalidateColumn( col_idx );
+	}
+
+	for( auto row_idx = cell.rect.top; row_idx < cell.rect.top + cell.rect.height; ++row_idx ) {
+		InvalidateRow( row_idx );
+	}
 
-		cell.child->SetAllocation( allocation );
+	if( !cell.pending_allocation ) {
+		cell.pending_allocation = true;
+		m_dirty_cells.push_back( &cell );
 	}
 }
 
+void Table::InvalidateLayout() {
+	m_requisitions_invalid = true;
+	m_allocations_invalid = true;
+}
+
 void Table::SetColumnSpacings( float spacing ) {
 	for( auto& column : m_columns ) {
 		column.spacing = spacing;
@@ -246,7 +364,7 @@ void Table::SetColumnSpacings( float spacing ) {
 
 	m_general_spacings.x = spacing;
 
-	UpdateRequisitions();
+	InvalidateLayout();
 	RequestResize();
 }
 
@@ -257,7 +375,7 @@ void Table::SetRowSpacings( float spacing ) {
 
 	m_general_spacings.y = spacing;
 
-	UpdateRequisitions();
+	InvalidateLayout();
 	RequestResize();
 }
 
@@ -268,7 +386,7 @@ void Table::SetColumnSpacing( std::size_t index, float spacing ) {
 
 	m_columns[index].spacing = spacing;
 
-	UpdateRequisitions();
+	InvalidateColumn( index );
 	RequestResize();
 }
 
@@ -279,7 +397,7 @@ void Table::SetRowSpacing( std::size_t index, float spacing ) {
 
 	m_rows[index].spacing = spacing;
 
-	UpdateRequisitions();
+	InvalidateRow( index );
 	RequestResize();
 }
 
@@ -292,16 +410,47 @@ void Table::HandleRequisitionChange() {
 	AllocateChildren();
 }
 
+void Table::HandleChildRequisitionChange( Widget::PtrConst child ) {
+	auto cell_iter = m_cell_map.find( child.get() );
+
+	if( cell_iter == m_cell_map.end() ) {
+		return;
+	}
+
+	InvalidateCell( *cell_iter->second );
+}
+
 void Table::HandleRemove( Widget::Ptr child ) {
-	TableCellList::iterator cell_iter( m_cells.begin() );
-	TableCellList::iterator cell_iter_end( m_cells.end() );
+	auto map_iter = m_cell_map.find( child.get() );
 
-	for( ; cell_iter != cell_iter_end; ++cell_iter ) {
-		if( cell_iter->child == child ) {
-			m_cells.erase( cell_iter );
-			return;
-		}
+	if( map_iter == m_cell_map.end() ) {
+		return;
 	}
+
+	auto cell_iter = map_iter->second;
+	auto& cell = *cell_iter;
+
+	// The columns and rows spanned by the cell have to be recalculated.
+	InvalidateCell( cell );
+
+	auto dirty_iter = std::find( m_dirty_cells.begin(), m_dirty_cells.end(), &cell );
+
+	if( dirty_iter != m_dirty_cells.end() ) {
+		m_dirty_cells.erase( dirty_iter );
+	}
+
+	for( auto col_idx = cell.rect.left; col_idx < cell.rect.left + cell.rect.width; ++col_idx ) {
+		auto& cells = m_columns[col_idx].cells;
+		cells.erase( std::find( cells.begin(), cells.end(), &cell ) );
+	}
+
+	for( auto row_idx = cell.rect.top; row_idx < cell.rect.top + cell.rect.height; ++row_idx ) {
+		auto& cells = m_rows[row_idx].cells;
+		cells.erase( std::find( cells.begin(), cells.end(), &cell ) );
+	}
+
+	m_cell_map.erase( map_iter );
+	m_cells.erase( cell_iter );
 }
 
 }
@@ -9,7 +9,8 @@ TableCell::TableCell( Widget::Ptr child_, const sf::Rect<sf::Uint32>& rect_, int
 	rect( rect_ ),
 	x_options( x_options_ ),
 	y_options( y_options_ ),
-	padding( padding_ )
+	padding( padding_ ),
+	pending_allocation( false )
 {
 }
 
@@ -8,7 +8,8 @@ TableOptions::TableOptions() :
 	requisition( 0.f ),
 	allocation( 0.f ),
 	spacing( 0.f ),
-	expand( true )
+	expand( true ),
+	dirty( false )
 {
 }
 
@@ -53,6 +53,9 @@ void Viewport::HandleSizeChange() {
 			std::floor( allocation.height + .5f )
 		)
 	);
+
+	// Let the child know the visible area changed.
+	HandleViewportUpdate();
 }
 
 void Viewport::HandleAbsolutePositionChange() {
@@ -95,6 +98,8 @@ void Viewport::HandleEvent( const sf::Event& event ) {
 			GetChild()->HandleEvent( altered_event );
 		} break;
 		case sf::Event::MouseLeft: {
+			SetMouseInWidget( false );
+
 			// Nice hack to cause scrolledwindow children to get out of
 			// prelight state when the mouse leaves the child allocation.
 			sf::Event altered_event( event );
@@ -104,7 +109,13 @@ void Viewport::HandleEvent( const sf::Event& event ) {
 		} break;
 		case sf::Event::MouseMoved: { // All MouseMove events
 			sf::Event altered_event( event );
-			if( !GetAllocation().contains( static_cast<float>( event.mouseMove.x ), static_cast<float>( event.mouseMove.y ) ) ) {
+			auto is_inside = GetAllocation().contains( static_cast<float>( event.mouseMove.x ), static_cast<float>( event.mouseMove.y ) );
+
+			// Our parent keeps passing us mouse moves as long as the mouse is
+			// inside, so our child gets the chance to notice it leaving.
+			SetMouseInWidget( is_inside );
+
+			if( !is_inside ) {
 				// Nice hack to cause scrolledwindow children to get out of
 				// prelight state when the mouse leaves the child allocation.
 				altered_event.mouseMove.x = -1;
@@ -196,6 +207,9 @@ void Viewport::SetVerticalAdjustment( Adjustment::Ptr vertical_adjustment ) {
 
 		viewport->UpdateView();
 	} );
+
+	// Let the child know it is scrolled by another adjustment now.
+	HandleViewportUpdate();
 }
 
 void Viewport::HandleRequisitionChange() {
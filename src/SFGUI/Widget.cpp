@@ -9,15 +9,52 @@
 #include <SFML/Window/Event.hpp>
 #include <cmath>
 #include <limits>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace {
 
+typedef std::unordered_map<std::string, std::unordered_set<sfg::Widget*>> WidgetIndex;
+
 std::weak_ptr<sfg::Widget> focus_widget;
 std::weak_ptr<sfg::Widget> active_widget;
 std::weak_ptr<sfg::Widget> modal_widget;
 
+const auto no_root_index = std::numeric_limits<std::size_t>::max();
+
 std::vector<sfg::Widget*> root_widgets;
 
+// Lookup tables for GetWidgetById() and GetWidgetsByClass(). They are
+// maintained by SetId(), SetClass() and the destructor.
+WidgetIndex id_index;
+WidgetIndex class_index;
+
+void AddToIndex( WidgetIndex& index, const std::string& key, sfg::Widget* widget ) {
+	if( key.empty() ) {
+		return;
+	}
+
+	index[key].insert( widget );
+}
+
+void RemoveFromIndex( WidgetIndex& index, const std::string& key, sfg::Widget* widget ) {
+	if( key.empty() ) {
+		return;
+	}
+
+	auto iter = index.find( key );
+
+	if( iter == index.end() ) {
+		return;
+	}
+
+	iter->second.erase( widget );
+
+	if( iter->second.empty() ) {
+		index.erase( iter );
+	}
+}
+
 }
 
 namespace sfg {
@@ -50,6 +87,7 @@ Signal::SignalID Widget::OnText = 0;
 Widget::Widget() :
 	m_hierarchy_level( 0 ),
 	m_z_order( 0 ),
+	m_root_index( no_root_index ),
 	m_invalidated( true ),
 	m_parent_notified( false ),
 	m_state( State::NORMAL ),
@@ -60,19 +98,16 @@ Widget::Widget() :
 	m_viewport = Renderer::Get().GetDefaultViewport();
 
 	// Register this as a root widget initially.
-	root_widgets.push_back( this );
+	RegisterRootWidget();
 }
 
 Widget::~Widget() {
-	if( !m_parent.lock() ) {
-		// If this widget is an orphan, we assume it is
-		// a root widget and try to de-register it.
-		std::vector<Widget*>::iterator iter( std::find( root_widgets.begin(), root_widgets.end(), this ) );
-
-		if( iter != root_widgets.end() ) {
-			root_widgets.erase( iter );
-		}
+	if( m_class_id ) {
+		RemoveFromIndex( id_index, m_class_id->id, this );
+		RemoveFromIndex( class_index, m_class_id->class_, this );
 	}
+
+	UnregisterRootWidget();
 }
 
 bool Widget::IsLocallyVisible() const {
@@ -140,6 +175,13 @@ void Widget::SetAllocation( const sf::FloatRect& rect ) {
 		return;
 	}
 
+	// The parent routes mouse events by its children's allocations.
+	auto parent = m_parent.lock();
+
+	if( parent ) {
+		parent->InvalidateHitGrid();
+	}
+
 	if( ( oldallocation.top != m_allocation.top ) || ( oldallocation.left != m_allocation.left ) ) {
 	  HandlePositionChange();
 	  HandleAbsolutePositionChange();
@@ -175,6 +217,7 @@ void Widget::RequestResize() {
 	GetSignals().Emit( OnSizeRequest );
 
 	if( parent ) {
+		parent->HandleChildRequisitionChange( static_cast<Widget::PtrConst>( shared_from_this() ) );
 		parent->RequestResize();
 	}
 	else {
@@ -252,21 +295,17 @@ void Widget::SetParent( Widget::Ptr parent ) {
 
 	m_parent = cont;
 
-	auto iter = std::find( root_widgets.begin(), root_widgets.end(), this );
+	HandleStyleChange();
 
 	if( parent ) {
 		// If this widget has a parent, it is no longer a root widget.
-		if( iter != root_widgets.end() ) {
-			root_widgets.erase( iter );
-		}
+		UnregisterRootWidget();
 
 		SetHierarchyLevel( parent->GetHierarchyLevel() + 1 );
 	}
 	else {
 		// If this widget does not have a parent, it becomes a root widget.
-		if( iter == root_widgets.end() ) {
-			root_widgets.push_back( this );
-		}
+		RegisterRootWidget();
 
 		SetHierarchyLevel( 0 );
 	}
@@ -480,6 +519,8 @@ void Widget::SetState( State state ) {
 	// Store the new state.
 	m_state = state;
 
+	HandleStyleChange();
+
 	auto emit_state_change = false;
 
 	// If HandleStateChange() changed the state, do not call observer, will be
@@ -563,6 +604,15 @@ void Widget::Show( bool show ) {
 	RequestResize();
 }
 
+const Atom& Widget::GetNameAtom() const {
+	// GetName() is virtual, so the atom can't be created in the ctor.
+	if( m_name_atom == Atom() ) {
+		m_name_atom = Atom( GetName() );
+	}
+
+	return m_name_atom;
+}
+
 const sf::Vector2f& Widget::GetRequisition() const {
 	return m_requisition;
 }
@@ -610,7 +660,11 @@ void Widget::SetId( const std::string& id ) {
 		m_class_id.reset( new ClassId );
 	}
 
+	RemoveFromIndex( id_index, m_class_id->id, this );
 	m_class_id->id = id;
+	AddToIndex( id_index, m_class_id->id, this );
+
+	HandleStyleChange();
 
 	Refresh();
 }
@@ -632,7 +686,11 @@ void Widget::SetClass( const std::string& cls ) {
 		m_class_id.reset( new ClassId );
 	}
 
+	RemoveFromIndex( class_index, m_class_id->class_, this );
 	m_class_id->class_ = cls;
+	AddToIndex( class_index, m_class_id->class_, this );
+
+	HandleStyleChange();
 
 	Refresh();
 }
@@ -645,101 +703,29 @@ std::string Widget::GetClass() const {
 	return m_class_id->class_;
 }
 
-Widget::Ptr SearchContainerForId( Container::PtrConst container, const std::string& id ) {
-	if( !container ) {
-		return Widget::Ptr();
-	}
-
-	for( const auto& child : container->GetChildren() ) {
-		if( child->GetId() == id ) {
-			return child;
-		}
-
-		auto child_container = std::dynamic_pointer_cast<Container>( child );
-
-		if( child_container ) {
-			auto widget = SearchContainerForId( child_container, id );
-
-			if( widget ) {
-				return widget;
-			}
-		}
-	}
-
-	return Widget::Ptr();
-}
-
 Widget::Ptr Widget::GetWidgetById( const std::string& id ) {
-	for( const auto& root_widget : root_widgets ) {
-		if( root_widget->GetId() == id ) {
-			return root_widget->shared_from_this();
-		}
+	auto iter = id_index.find( id );
 
-		auto container = std::dynamic_pointer_cast<Container>(
-			root_widget->shared_from_this()
-		);
-
-		if( container ) {
-			auto widget = SearchContainerForId( container, id );
-
-			if( widget ) {
-				return widget;
-			}
-		}
-	}
-
-	return Widget::Ptr();
-}
-
-Widget::WidgetsList SearchContainerForClass( Container::PtrConst container, const std::string& class_name ) {
-	Widget::WidgetsList result;
-
-	if( !container ) {
-		return result;
-	}
-
-	for( const auto& child : container->GetChildren() ) {
-		if( child->GetClass() == class_name ) {
-			result.push_back( child );
-		}
-
-		auto child_container = std::dynamic_pointer_cast<Container>( child );
-
-		if( child_container ) {
-			auto child_result = SearchContainerForClass( child_container, class_name );
-
-			// Splice the 2 vectors.
-			if( !child_result.empty() ) {
-				result.reserve( child_result.size() );
-				result.insert( result.end(), child_result.begin(), child_result.end() );
-			}
-		}
+	if( iter == id_index.end() ) {
+		return Widget::Ptr();
 	}
 
-	return result;
+	return ( *iter->second.begin() )->shared_from_this();
 }
 
 Widget::WidgetsList Widget::GetWidgetsByClass( const std::string& class_name ) {
 	WidgetsList result;
 
-	for( const auto& root_widget : root_widgets ) {
-		if( root_widget->GetClass() == class_name ) {
-			result.push_back( root_widget->shared_from_this() );
-		}
+	auto iter = class_index.find( class_name );
 
-		auto container = std::dynamic_pointer_cast<Container>(
-			root_widget->shared_from_this()
-		);
+	if( iter == class_index.end() ) {
+		return result;
+	}
 
-		if( container ) {
-			auto container_result = SearchContainerForClass( container, class_name );
+	result.reserve( iter->second.size() );
 
-			// Splice the 2 vectors.
-			if( !container_result.empty() ) {
-				result.reserve( container_result.size() );
-				result.insert( result.end(), container_result.begin(), container_result.end() );
-			}
-		}
+	for( const auto& widget : iter->second ) {
+		result.push_back( widget->shared_from_this() );
 	}
 
 	return result;
@@ -797,6 +783,10 @@ void Widget::HandleGlobalVisibilityChange() {
 	}
 }
 
+void Widget::HandleStyleChange() {
+	m_style.reset();
+}
+
 void Widget::HandleAbsolutePositionChange() {
 	UpdateDrawablePosition();
 }
@@ -919,8 +909,49 @@ bool Widget::HasModal() {
 	return !modal_widget.expired();
 }
 
+Widget::Ptr Widget::GetFocusWidget() {
+	return focus_widget.lock();
+}
+
+Widget::Ptr Widget::GetActiveWidget() {
+	return active_widget.lock();
+}
+
+Widget::Ptr Widget::GetModalWidget() {
+	return modal_widget.lock();
+}
+
+bool Widget::IsTrackingMouse( PtrConst widget ) {
+	return widget->IsMouseInWidget() || widget->IsMouseButtonDown();
+}
+
 const std::vector<Widget*>& Widget::GetRootWidgets() {
 	return root_widgets;
 }
 
+void Widget::RegisterRootWidget() {
+	if( m_root_index != no_root_index ) {
+		return;
+	}
+
+	m_root_index = root_widgets.size();
+	root_widgets.push_back( this );
+}
+
+void Widget::UnregisterRootWidget() {
+	if( m_root_index == no_root_index ) {
+		return;
+	}
+
+	// Move the last root widget into the freed slot so removal doesn't have
+	// to shift the whole list.
+	auto last_widget = root_widgets.back();
+
+	root_widgets[m_root_index] = last_widget;
+	last_widget->m_root_index = m_root_index;
+
+	root_widgets.pop_back();
+	m_root_index = no_root_index;
+}
+
 }
@@ -0,0 +1,60 @@
+// Compiles a theme into the binary format that sfg::Engine::LoadThemeFromFile()
+// and sfg::Engine::LoadThemeFromMemory() install without parsing it.
+//
+// Usage: CompileTheme <theme> <compiled theme>
+
+#include <SFGUI/Engine.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+int main( int argc, char* argv[] ) {
+	if( argc != 3 ) {
+		std::cerr << "Usage: " << argv[0] << " <theme> <compiled theme>\n";
+		return EXIT_FAILURE;
+	}
+
+	std::string theme_path( argv[1] );
+	std::string compiled_path( argv[2] );
+
+	std::ifstream input( theme_path );
+
+	if( !input ) {
+		std::cerr << "Couldn't read \"" << theme_path << "\".\n";
+		return EXIT_FAILURE;
+	}
+
+	std::string theme(
+		( std::istreambuf_iterator<char>( input ) ),
+		( std::istreambuf_iterator<char>() )
+	);
+
+	std::vector<char> compiled;
+
+	try {
+		if( !sfg::Engine::CompileTheme( theme, compiled ) ) {
+			std::cerr << "Couldn't compile \"" << theme_path << "\".\n";
+			return EXIT_FAILURE;
+		}
+	}
+	catch( const std::runtime_error& error ) {
+		std::cerr << "Couldn't compile \"" << theme_path << "\": " << error.what() << "\n";
+		return EXIT_FAILURE;
+	}
+
+	std::ofstream output( compiled_path, std::ios::binary );
+
+	if( !output.write( compiled.data(), static_cast<std::streamsize>( compiled.size() ) ) ) {
+		std::cerr << "Couldn't write \"" << compiled_path << "\".\n";
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "Compiled \"" << theme_path << "\" into \"" << compiled_path << "\" (" << compiled.size() << " bytes).\n";
+
+	return EXIT_SUCCESS;
+}
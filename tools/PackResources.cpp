@@ -0,0 +1,239 @@
+// Packs all files of a directory into a resource archive that can be
+// loaded with sfg::ArchiveResourceLoader.
+//
+// Usage: PackResources [--decode] <directory> <archive>
+//
+// With --decode, images are stored as raw RGBA pixels so loading them
+// doesn't involve decoding anymore. This makes archives bigger.
+
+#include <SFGUI/ResourceArchive.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#if defined( SFGUI_SYSTEM_WINDOWS )
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cctype>
+#include <cstdlib>
+
+namespace {
+
+struct Entry {
+	std::string name;
+	std::vector<char> data;
+	std::uint32_t type;
+	std::uint32_t width;
+	std::uint32_t height;
+};
+
+// Collects the paths of all files below directory, relative to it and with / as separator.
+bool ListFiles( const std::string& directory, const std::string& prefix, std::vector<std::string>& files ) {
+#if defined( SFGUI_SYSTEM_WINDOWS )
+	WIN32_FIND_DATAA find_data;
+	auto find = FindFirstFileA( ( directory + "\\*" ).c_str(), &find_data );
+
+	if( find == INVALID_HANDLE_VALUE ) {
+		return false;
+	}
+
+	do {
+		std::string name( find_data.cFileName );
+
+		if( ( name == "." ) || ( name == ".." ) ) {
+			continue;
+		}
+
+		if( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) {
+			ListFiles( directory + "\\" + name, prefix + name + "/", files );
+		}
+		else {
+			files.push_back( prefix + name );
+		}
+	} while( FindNextFileA( find, &find_data ) );
+
+	FindClose( find );
+#else
+	auto dir = opendir( directory.c_str() );
+
+	if( !dir ) {
+		return false;
+	}
+
+	while( auto dir_entry = readdir( dir ) ) {
+		std::string name( dir_entry->d_name );
+
+		if( ( name == "." ) || ( name == ".." ) ) {
+			continue;
+		}
+
+		struct stat status;
+
+		if( stat( ( directory + "/" + name ).c_str(), &status ) ) {
+			continue;
+		}
+
+		if( S_ISDIR( status.st_mode ) ) {
+			ListFiles( directory + "/" + name, prefix + name + "/", files );
+		}
+		else if( S_ISREG( status.st_mode ) ) {
+			files.push_back( prefix + name );
+		}
+	}
+
+	closedir( dir );
+#endif
+
+	return true;
+}
+
+bool IsImage( const std::string& name ) {
+	static const char* extensions[] = { ".bmp", ".png", ".tga", ".jpg", ".jpeg", ".gif", ".psd", ".hdr", ".pic" };
+
+	auto dot = name.rfind( '.' );
+
+	if( dot == std::string::npos ) {
+		return false;
+	}
+
+	auto extension = name.substr( dot );
+	std::transform( extension.begin(), extension.end(), extension.begin(), []( char character ) {
+		return static_cast<char>( std::tolower( static_cast<unsigned char>( character ) ) );
+	} );
+
+	return std::find( std::begin( extensions ), std::end( extensions ), extension ) != std::end( extensions );
+}
+
+std::size_t Align( std::size_t offset ) {
+	return ( offset + sfg::priv::archive::alignment - 1 ) / sfg::priv::archive::alignment * sfg::priv::archive::alignment;
+}
+
+}
+
+int main( int argc, char* argv[] ) {
+	std::vector<std::string> arguments( argv + 1, argv + argc );
+
+	auto decode = false;
+
+	if( !arguments.empty() && ( arguments.front() == "--decode" ) ) {
+		decode = true;
+		arguments.erase( arguments.begin() );
+	}
+
+	if( arguments.size() != 2 ) {
+		std::cerr << "Usage: " << argv[0] << " [--decode] <directory> <archive>\n";
+		return EXIT_FAILURE;
+	}
+
+	const auto& directory = arguments[0];
+	const auto& archive_path = arguments[1];
+
+	std::vector<std::string> names;
+
+	if( !ListFiles( directory, "", names ) ) {
+		std::cerr << "Couldn't read directory \"" << directory << "\".\n";
+		return EXIT_FAILURE;
+	}
+
+	// The loader looks entries up with a binary search.
+	std::sort( names.begin(), names.end() );
+
+	std::vector<Entry> entries;
+
+	for( const auto& name : names ) {
+		std::ifstream file( directory + "/" + name, std::ios::binary );
+
+		if( !file ) {
+			std::cerr << "Couldn't read \"" << name << "\".\n";
+			return EXIT_FAILURE;
+		}
+
+		Entry entry;
+		entry.name = name;
+		entry.data.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+		entry.type = sfg::priv::archive::RAW;
+		entry.width = 0;
+		entry.height = 0;
+
+		sf::Image image;
+
+		if( decode && IsImage( name ) && !entry.data.empty() && image.loadFromMemory( entry.data.data(), entry.data.size() ) ) {
+			auto pixels = reinterpret_cast<const char*>( image.getPixelsPtr() );
+
+			entry.data.assign( pixels, pixels + image.getSize().x * image.getSize().y * 4 );
+			entry.type = sfg::priv::archive::RGBA;
+			entry.width = image.getSize().x;
+			entry.height = image.getSize().y;
+		}
+
+		entries.push_back( std::move( entry ) );
+	}
+
+	// Lay out header, table, names and data.
+	auto names_offset = sfg::priv::archive::header_size + entries.size() * sfg::priv::archive::entry_size;
+	auto size = names_offset;
+
+	for( const auto& entry : entries ) {
+		size += entry.name.size();
+	}
+
+	std::vector<std::size_t> data_offsets;
+
+	for( const auto& entry : entries ) {
+		size = Align( size );
+		data_offsets.push_back( size );
+		size += entry.data.size();
+	}
+
+	if( size > std::numeric_limits<std::uint32_t>::max() ) {
+		std::cerr << "Archive would exceed 4 GiB.\n";
+		return EXIT_FAILURE;
+	}
+
+	std::vector<char> archive( size, 0 );
+
+	std::copy( std::begin( sfg::priv::archive::magic ), std::end( sfg::priv::archive::magic ), archive.begin() );
+	sfg::priv::archive::Write( &archive[4], sfg::priv::archive::version );
+	sfg::priv::archive::Write( &archive[8], static_cast<std::uint32_t>( entries.size() ) );
+
+	auto name_offset = names_offset;
+
+	for( std::size_t index = 0; index < entries.size(); ++index ) {
+		const auto& entry = entries[index];
+		auto record = &archive[sfg::priv::archive::header_size + index * sfg::priv::archive::entry_size];
+
+		sfg::priv::archive::Write( record + sfg::priv::archive::NAME_OFFSET * 4, static_cast<std::uint32_t>( name_offset ) );
+		sfg::priv::archive::Write( record + sfg::priv::archive::NAME_LENGTH * 4, static_cast<std::uint32_t>( entry.name.size() ) );
+		sfg::priv::archive::Write( record + sfg::priv::archive::DATA_OFFSET * 4, static_cast<std::uint32_t>( data_offsets[index] ) );
+		sfg::priv::archive::Write( record + sfg::priv::archive::DATA_SIZE * 4, static_cast<std::uint32_t>( entry.data.size() ) );
+		sfg::priv::archive::Write( record + sfg::priv::archive::TYPE * 4, entry.type );
+		sfg::priv::archive::Write( record + sfg::priv::archive::WIDTH * 4, entry.width );
+		sfg::priv::archive::Write( record + sfg::priv::archive::HEIGHT * 4, entry.height );
+
+		std::copy( entry.name.begin(), entry.name.end(), archive.begin() + static_cast<std::ptrdiff_t>( name_offset ) );
+		std::copy( entry.data.begin(), entry.data.end(), archive.begin() + static_cast<std::ptrdiff_t>( data_offsets[index] ) );
+
+		name_offset += entry.name.size();
+	}
+
+	std::ofstream output( archive_path, std::ios::binary );
+
+	if( !output.write( archive.data(), static_cast<std::streamsize>( archive.size() ) ) ) {
+		std::cerr << "Couldn't write \"" << archive_path << "\".\n";
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "Packed " << entries.size() << " files into \"" << archive_path << "\" (" << archive.size() << " bytes).\n";
+
+	return EXIT_SUCCESS;
+}